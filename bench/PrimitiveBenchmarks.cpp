@@ -0,0 +1,265 @@
+#include "BigRational.hpp"
+#include "GaloisField.hpp"
+#include "Monomial.hpp"
+#include "MonomialOrders.hpp"
+#include "MultivariatePolynomial.hpp"
+#include "Rational.hpp"
+#include "Systems.hpp"
+#include "UnivariatePolynomial.hpp"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Micro-benchmarks of the primitives inside the Groebner basis hot loop. Every benchmark reports
+ * `allocs` and `bytes`, the heap allocations per operation seen by the global `operator new`.
+ */
+
+namespace {
+
+std::atomic<int64_t> allocationCount{0};
+std::atomic<int64_t> allocatedBytes{0};
+
+//  Counts the allocations between its construction and `report`
+class AllocationCounter {
+public:
+    AllocationCounter()
+        : _count(allocationCount.load(std::memory_order_relaxed)),
+          _bytes(allocatedBytes.load(std::memory_order_relaxed)) { }
+
+    void report(benchmark::State& state) const {
+        const double count = allocationCount.load(std::memory_order_relaxed) - _count;
+        const double bytes = allocatedBytes.load(std::memory_order_relaxed) - _bytes;
+        state.counters["allocs"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+        state.counters["bytes"] = benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    int64_t _count;
+    int64_t _bytes;
+};
+
+} //  namespace
+
+//  The replaced allocation functions are a matching pair, GCC only sees `free` after `new`
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+constexpr int64_t benchmarkPrime = 32'003;
+
+const Monomial a("a^3b^2cd^4");
+const Monomial b("a^2b^5d");
+const Monomial ab = a * b;
+const std::vector<char> variables = Systems::variables(4);
+
+template<typename Operation> void monomialBenchmark(benchmark::State& state, Operation operation) {
+    AllocationCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(operation());
+    }
+    counter.report(state);
+}
+
+BENCHMARK_CAPTURE(monomialBenchmark, Multiply, [] { return a * b; });
+BENCHMARK_CAPTURE(monomialBenchmark, Divide, [] { return ab / b; });
+BENCHMARK_CAPTURE(monomialBenchmark, Lcm, [] { return Monomial::lcm(a, b); });
+BENCHMARK_CAPTURE(monomialBenchmark, Divides, [] { return Monomial::divides(ab, b); });
+BENCHMARK_CAPTURE(monomialBenchmark, RebuildPair, [] {
+    const Monomial x(a.getMonomial());
+    const Monomial y(b.getMonomial());
+    return x.getDegree() + y.getDegree();
+});
+
+//  `a` and `b` keep their order keys after the first call, this measures cached compares only
+template<typename Order> void orderCompare(benchmark::State& state, Order order) {
+    AllocationCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(order.compare(a, b));
+    }
+    counter.report(state);
+}
+
+/**
+ * @brief Compares monomials rebuilt from their exponents, which carry no key yet, so both keys are
+ * encoded on every call. Copies would keep the cached keys. Minus `RebuildPair` this is the cost
+ * of a compare on fresh monomials.
+ */
+template<typename Order> void orderCompareUncached(benchmark::State& state, Order order) {
+    AllocationCounter counter;
+    for (auto _ : state) {
+        const Monomial x(a.getMonomial());
+        const Monomial y(b.getMonomial());
+        benchmark::DoNotOptimize(order.compare(x, y));
+    }
+    counter.report(state);
+}
+
+BENCHMARK_CAPTURE(orderCompare, Lex, LexOrder(variables));
+BENCHMARK_CAPTURE(orderCompare, GradedLex, GradedLexOrder(variables));
+BENCHMARK_CAPTURE(orderCompare, GradedRevLex, GradedRevLexOrder(variables));
+BENCHMARK_CAPTURE(orderCompare, Weighted, WeightedOrder({1, 2, 3, 4}, variables));
+BENCHMARK_CAPTURE(orderCompareUncached, Lex, LexOrder(variables));
+BENCHMARK_CAPTURE(orderCompareUncached, GradedLex, GradedLexOrder(variables));
+BENCHMARK_CAPTURE(orderCompareUncached, GradedRevLex, GradedRevLexOrder(variables));
+BENCHMARK_CAPTURE(orderCompareUncached, Weighted, WeightedOrder({1, 2, 3, 4}, variables));
+
+//  Dense operands `(a + b + c + d + 1)^3` and `(a - 2b + 3c - d + 5)^2` with 35 and 15 terms
+template<typename F> std::pair<MultivariatePolynomial<F>, MultivariatePolynomial<F>> operands() {
+    std::vector<MultivariatePolynomial<F>> x = Systems::defineVariables<F>(4);
+    MultivariatePolynomial<F> f = (x[0] + x[1] + x[2] + x[3] + F::one) ^ 3;
+    MultivariatePolynomial<F> g = (x[0] - 2 * x[1] + 3 * x[2] - x[3] + 5) ^ 2;
+    return {f, g};
+}
+
+template<typename F> void polynomialMultiply(benchmark::State& state) {
+    const auto [f, g] = operands<F>();
+    AllocationCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f * g);
+    }
+    counter.report(state);
+}
+
+template<typename F> void polynomialSubtract(benchmark::State& state) {
+    const auto [f, g] = operands<F>();
+    AllocationCounter counter;
+    for (auto _ : state) {
+        MultivariatePolynomial<F> h = f;
+        h -= g;
+        benchmark::DoNotOptimize(h);
+    }
+    counter.report(state);
+}
+
+BENCHMARK_TEMPLATE(polynomialMultiply, Rational);
+BENCHMARK_TEMPLATE(polynomialMultiply, BigRational);
+BENCHMARK_TEMPLATE(polynomialMultiply, GaloisField);
+BENCHMARK_TEMPLATE(polynomialSubtract, Rational);
+BENCHMARK_TEMPLATE(polynomialSubtract, BigRational);
+BENCHMARK_TEMPLATE(polynomialSubtract, GaloisField);
+
+/**
+ * @brief Dense polynomial of degree `state.range(0)` over `GF(p)` at the 4096 candidates of one
+ * block of `findGaloisFieldRoots`. `multipointHorner` is the plain loop over `evaluate` that
+ * `evaluateMany` has to beat at every degree.
+ */
+std::pair<UnivariatePolynomial<GaloisField>, std::vector<GaloisField>>
+    multipointOperands(int degree) {
+    std::vector<GaloisField> coefficients;
+    for (int i = 0; i <= degree; i++) {
+        coefficients.push_back(GaloisField((i * 7'919 + 1) % benchmarkPrime));
+    }
+    std::vector<GaloisField> points;
+    for (int i = 0; i < 4'096; i++) {
+        points.push_back(GaloisField(i));
+    }
+    return {UnivariatePolynomial<GaloisField>(coefficients), points};
+}
+
+void multipointEvaluate(benchmark::State& state) {
+    const auto [f, points] = multipointOperands(state.range(0));
+    AllocationCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(f.evaluateMany(points));
+    }
+    counter.report(state);
+}
+
+void multipointHorner(benchmark::State& state) {
+    const auto [f, points] = multipointOperands(state.range(0));
+    std::vector<GaloisField> values(points.size());
+    AllocationCounter counter;
+    for (auto _ : state) {
+        for (int i = 0; i < points.size(); i++) {
+            values[i] = f.evaluate(points[i]);
+        }
+        benchmark::DoNotOptimize(values);
+    }
+    counter.report(state);
+}
+
+BENCHMARK(multipointEvaluate)
+    ->Arg(31)
+    ->Arg(33)
+    ->Arg(129)
+    ->Arg(512)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(multipointHorner)
+    ->Arg(31)
+    ->Arg(33)
+    ->Arg(129)
+    ->Arg(512)
+    ->Unit(benchmark::kMicrosecond);
+
+//  Non-trivial operands: `355 / 113` and `-103993 / 33102` in the rational fields
+template<typename F> std::pair<F, F> fieldOperands() {
+    return {F(355) / F(113), F(-103'993) / F(33'102)};
+}
+
+template<typename F, typename Operation>
+void fieldBenchmark(benchmark::State& state, Operation operation) {
+    const auto [x, y] = fieldOperands<F>();
+    AllocationCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(operation(x, y));
+    }
+    counter.report(state);
+}
+
+template<typename F> void fieldAdd(benchmark::State& state) {
+    fieldBenchmark<F>(state, [](const F& x, const F& y) { return x + y; });
+}
+
+template<typename F> void fieldMultiply(benchmark::State& state) {
+    fieldBenchmark<F>(state, [](const F& x, const F& y) { return x * y; });
+}
+
+template<typename F> void fieldDivide(benchmark::State& state) {
+    fieldBenchmark<F>(state, [](const F& x, const F& y) { return x / y; });
+}
+
+BENCHMARK_TEMPLATE(fieldAdd, Rational);
+BENCHMARK_TEMPLATE(fieldAdd, BigRational);
+BENCHMARK_TEMPLATE(fieldAdd, GaloisField);
+BENCHMARK_TEMPLATE(fieldMultiply, Rational);
+BENCHMARK_TEMPLATE(fieldMultiply, BigRational);
+BENCHMARK_TEMPLATE(fieldMultiply, GaloisField);
+BENCHMARK_TEMPLATE(fieldDivide, Rational);
+BENCHMARK_TEMPLATE(fieldDivide, BigRational);
+BENCHMARK_TEMPLATE(fieldDivide, GaloisField);
+
+} //  namespace
+
+int main(int argc, char** argv) {
+    GaloisField::setPrime(benchmarkPrime);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include "BigRational.hpp"
+#include "GaloisField.hpp"
+#include "GroebnerBasis.hpp"
+#include "Logger.hpp"
+#include "MonomialOrders.hpp"
+#include "Rational.hpp"
+#include "Real.hpp"
+#include "Solver.hpp"
+#include "Systems.hpp"
+
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Whole-system benchmarks. Every case is registered as `<operation>/<family>-<size>/<field>`, so
+ * e.g. `--benchmark_filter=GroebnerBasis/katsura` selects one family over all fields.
+ */
+
+namespace {
+
+template<typename F> using System = std::vector<MultivariatePolynomial<F>>;
+template<typename F> using RootFinder = std::vector<F> (*)(const UnivariatePolynomial<F>&);
+
+//  Prime of the `GaloisField` cases, large enough to avoid accidental structure modulo p
+constexpr int64_t benchmarkPrime = 32'003;
+
+struct Case {
+    std::string family;
+    int n;
+    int m = 0;
+
+    std::string name() const {
+        return family + "-" + std::to_string(n) + (m > 0 ? "-" + std::to_string(m) : "");
+    }
+};
+
+template<typename F> System<F> generate(const Case& c) {
+    if (c.family == "cyclic") {
+        return Systems::cyclic<F>(c.n);
+    }
+    if (c.family == "katsura") {
+        return Systems::katsura<F>(c.n);
+    }
+    if (c.family == "noon") {
+        return Systems::noon<F>(c.n);
+    }
+    if (c.family == "eco") {
+        return Systems::eco<F>(c.n);
+    }
+    if (c.family == "powersum") {
+        return Systems::powerSum<F>(c.n, c.m);
+    }
+    throw std::invalid_argument("Unknown system family: " + c.family);
+}
+
+template<typename F> void groebnerBasis(benchmark::State& state, const System<F>& system) {
+    const GradedRevLexOrder order(Systems::variablesOf(system));
+    size_t basisSize = 0;
+    for (auto _ : state) {
+        basisSize = calculateGroebnerBasis(system, order).size();
+        benchmark::DoNotOptimize(basisSize);
+    }
+    state.counters["basis"] = basisSize;
+}
+
+/**
+ * @brief Conversion of the grevlex basis of the system, homogenized with `z`, to lex. Only the
+ * conversion is timed, the grevlex basis is computed once up front.
+ */
+template<typename F> void orderConversion(benchmark::State& state, const System<F>& system) {
+    System<F> homogeneous;
+    for (const MultivariatePolynomial<F>& f : system) {
+        homogeneous.push_back(f.homogenize('z'));
+    }
+    const GradedRevLexOrder source(Systems::variablesOf(homogeneous));
+    const LexOrder target(Systems::variablesOf(homogeneous));
+    const System<F> G = calculateGroebnerBasis(homogeneous, source);
+
+    size_t basisSize = 0;
+    for (auto _ : state) {
+        basisSize = convertGroebnerBasis(G, source, target).size();
+        benchmark::DoNotOptimize(basisSize);
+    }
+    state.counters["basis"] = basisSize;
+}
+
+template<typename F> void characteristic(benchmark::State& state, const System<F>& system) {
+    for (auto _ : state) {
+        auto equations = characteristicEquations(system);
+        benchmark::DoNotOptimize(equations);
+    }
+}
+
+template<typename F>
+void solve(benchmark::State& state, const System<F>& system, RootFinder<F> rootFinder) {
+    for (auto _ : state) {
+        auto solutions = solveSystem<F>(system, rootFinder);
+        benchmark::DoNotOptimize(solutions);
+    }
+}
+
+template<typename F>
+void rootFinding(benchmark::State& state, const UnivariatePolynomial<F>& f,
+                 RootFinder<F> rootFinder) {
+    size_t roots = 0;
+    for (auto _ : state) {
+        roots = rootFinder(f).size();
+        benchmark::DoNotOptimize(roots);
+    }
+    state.counters["roots"] = roots;
+}
+
+/**
+ * @brief Registers all operations of one field. `solvable` are the cases with finitely many
+ * solutions that `solveSystem` and `characteristicEquations` can handle in reasonable time.
+ * `solveFinder` is handed to `solveSystem`, which only passes it square-free polynomials.
+ */
+template<typename F>
+void registerField(const std::string& field, RootFinder<F> rootFinder, RootFinder<F> solveFinder,
+                   const std::vector<Case>& groebner, const std::vector<Case>& solvable,
+                   const std::vector<int>& rootDegrees) {
+
+    for (const Case& c : groebner) {
+        benchmark::RegisterBenchmark(("GroebnerBasis/" + c.name() + "/" + field).c_str(),
+                                     groebnerBasis<F>, generate<F>(c))
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (const Case& c : solvable) {
+        benchmark::RegisterBenchmark(("CharacteristicEquations/" + c.name() + "/" + field).c_str(),
+                                     characteristic<F>, generate<F>(c))
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("SolveSystem/" + c.name() + "/" + field).c_str(), solve<F>,
+                                     generate<F>(c), solveFinder)
+            ->Unit(benchmark::kMillisecond);
+    }
+
+    for (int degree : rootDegrees) {
+        benchmark::RegisterBenchmark(
+            ("RootFinder/wilkinson-" + std::to_string(degree) + "/" + field).c_str(),
+            rootFinding<F>, Systems::wilkinson<F>(degree), rootFinder)
+            ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+//  Order conversions only pay off where the exact lex basis is expensive
+template<typename F>
+void registerConversions(const std::string& field, const std::vector<Case>& conversions) {
+    for (const Case& c : conversions) {
+        benchmark::RegisterBenchmark(("OrderConversion/" + c.name() + "/" + field).c_str(),
+                                     orderConversion<F>, generate<F>(c))
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+
+void registerAll() {
+    const std::vector<Case> solvable = {
+        {"katsura", 2},
+        {"eco", 4},
+        {"powersum", 2, 3},
+        {"powersum", 3, 4},
+    };
+
+    //  Exact fields with unbounded coefficients and floating point share the same instances
+    const std::vector<Case> groebner = {
+        {"cyclic", 4},
+        {"katsura", 3},
+        {"noon", 3},
+        {"eco", 4},
+        {"eco", 5},
+        {"powersum", 2, 3},
+        {"powersum", 2, 5},
+        {"powersum", 3, 4},
+        {"powersum", 3, 5},
+        {"powersum", 4, 5},
+    };
+
+    //  Coefficients never grow modulo p, so larger instances stay affordable
+    const std::vector<Case> groebnerModular = {
+        {"cyclic", 4},
+        {"katsura", 3},
+        {"noon", 3},
+        {"noon", 4},
+        {"eco", 5},
+        {"eco", 6},
+        {"powersum", 3, 5},
+    };
+
+    //  64 bit coefficients overflow quickly, only the smallest instances stay exact
+    const std::vector<Case> groebnerSmall = {
+        {"cyclic", 4},
+        {"katsura", 2},
+        {"eco", 4},
+        {"powersum", 2, 3},
+        {"powersum", 2, 5},
+    };
+    const std::vector<Case> solvableSmall = {
+        {"katsura", 2},
+        {"powersum", 2, 3},
+    };
+
+    //  Wilkinson roots lie in the first block of candidates, each search is one `evaluateMany`
+    registerField<GaloisField>("GaloisField", findGaloisFieldRoots,
+                               findGaloisFieldRootsSquareFree, groebnerModular, solvable,
+                               {8, 16, 33, 129});
+    registerField<BigRational>("BigRational", findBigRationalRoots,
+                               findBigRationalRootsSquareFree, groebner, solvable, {8, 16, 24});
+    registerField<Rational>("Rational", findRationalRoots, findRationalRootsSquareFree,
+                            groebnerSmall, solvableSmall, {8, 12});
+
+    const std::vector<Case> conversions = {
+        {"cyclic", 4},
+        {"katsura", 3},
+        {"noon", 3},
+        {"eco", 4},
+        {"powersum", 3, 4},
+    };
+    registerConversions<GaloisField>("GaloisField", conversions);
+    registerConversions<BigRational>("BigRational", conversions);
+    registerField<Real>("Real", findRealRoots, findRealRoots, groebner, solvable, {8, 16});
+}
+
+} //  namespace
+
+int main(int argc, char** argv) {
+    Logger::setLevel(Logger::Level::Off);
+    GaloisField::setPrime(benchmarkPrime);
+
+    registerAll();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,171 @@
+#ifndef BENCH_SYSTEMS_HPP
+#define BENCH_SYSTEMS_HPP
+
+#include "MultivariatePolynomial.hpp"
+#include "UnivariatePolynomial.hpp"
+
+#include <set>
+#include <vector>
+
+/**
+ * @brief Standard polynomial system families used for benchmarking. Variables are named `a`, `b`,
+ * `c`, ... in the order in which the families are usually written down.
+ */
+namespace Systems {
+
+inline std::vector<char> variables(int n) {
+    std::vector<char> result;
+    for (int i = 0; i < n; i++) {
+        result.push_back('a' + i);
+    }
+    return result;
+}
+
+//  Variables occurring in `system` in alphabetical order, the variables `solveSystem` orders
+template<typename F>
+std::vector<char> variablesOf(const std::vector<MultivariatePolynomial<F>>& system) {
+    std::set<char> result;
+    for (const MultivariatePolynomial<F>& f : system) {
+        for (char var : f.getVariables()) {
+            result.insert(var);
+        }
+    }
+    return std::vector<char>(result.begin(), result.end());
+}
+
+template<typename F> std::vector<MultivariatePolynomial<F>> defineVariables(int n) {
+    std::vector<MultivariatePolynomial<F>> result;
+    for (char var : variables(n)) {
+        result.push_back(defineVariable<F>(var));
+    }
+    return result;
+}
+
+/**
+ * @brief Cyclic n-roots: the elementary cyclic sums of length `1, ..., n - 1` vanish and the
+ * product of all variables is `1`
+ */
+template<typename F> std::vector<MultivariatePolynomial<F>> cyclic(int n) {
+    std::vector<MultivariatePolynomial<F>> x = defineVariables<F>(n);
+    std::vector<MultivariatePolynomial<F>> system;
+
+    for (int length = 1; length < n; length++) {
+        MultivariatePolynomial<F> f;
+        for (int start = 0; start < n; start++) {
+            MultivariatePolynomial<F> term(F::one);
+            for (int k = 0; k < length; k++) {
+                term *= x[(start + k) % n];
+            }
+            f += term;
+        }
+        system.push_back(f);
+    }
+
+    MultivariatePolynomial<F> product(F::one);
+    for (const MultivariatePolynomial<F>& xi : x) {
+        product *= xi;
+    }
+    system.push_back(product - F::one);
+    return system;
+}
+
+/**
+ * @brief Katsura system in the `n + 1` unknowns `u_0, ..., u_n` with `u_{-k} = u_k` and `u_k = 0`
+ * for `k > n`
+ */
+template<typename F> std::vector<MultivariatePolynomial<F>> katsura(int n) {
+    std::vector<MultivariatePolynomial<F>> u = defineVariables<F>(n + 1);
+    auto variable = [&](int k) {
+        k = k < 0 ? -k : k;
+        return k <= n ? u[k] : MultivariatePolynomial<F>();
+    };
+
+    std::vector<MultivariatePolynomial<F>> system;
+    for (int m = 0; m < n; m++) {
+        MultivariatePolynomial<F> f;
+        for (int l = -n; l <= n; l++) {
+            f += variable(l) * variable(m - l);
+        }
+        system.push_back(f - u[m]);
+    }
+
+    MultivariatePolynomial<F> f = u[0];
+    for (int l = 1; l <= n; l++) {
+        f += 2 * u[l];
+    }
+    system.push_back(f - F::one);
+    return system;
+}
+
+/**
+ * @brief Noonburg's neural network model `x_i (sum_{j != i} x_j^2) - 1.1 x_i + 1`, scaled by `10`
+ * to keep the coefficients integral
+ */
+template<typename F> std::vector<MultivariatePolynomial<F>> noon(int n) {
+    std::vector<MultivariatePolynomial<F>> x = defineVariables<F>(n);
+    std::vector<MultivariatePolynomial<F>> system;
+
+    for (int i = 0; i < n; i++) {
+        MultivariatePolynomial<F> squares;
+        for (int j = 0; j < n; j++) {
+            if (j != i) {
+                squares += x[j] * x[j];
+            }
+        }
+        system.push_back(10 * x[i] * squares - 11 * x[i] + 10);
+    }
+    return system;
+}
+
+/**
+ * @brief Economic modelling problem of Morgan:
+ * `(x_k + sum_{i=1}^{n-k-1} x_i x_{i+k}) x_n - k` for `k < n` and `x_1 + ... + x_{n-1} + 1`
+ */
+template<typename F> std::vector<MultivariatePolynomial<F>> eco(int n) {
+    std::vector<MultivariatePolynomial<F>> x = defineVariables<F>(n);
+    std::vector<MultivariatePolynomial<F>> system;
+
+    for (int k = 1; k < n; k++) {
+        MultivariatePolynomial<F> f = x[k - 1];
+        for (int i = 1; i <= n - k - 1; i++) {
+            f += x[i - 1] * x[i + k - 1];
+        }
+        system.push_back(f * x[n - 1] - k);
+    }
+
+    MultivariatePolynomial<F> f(F::one);
+    for (int i = 0; i < n - 1; i++) {
+        f += x[i];
+    }
+    system.push_back(f);
+    return system;
+}
+
+/**
+ * @brief Power sums `a^n + b^n - (1 + 2^n)` and `a^m + b^m - (1 + 2^m)` of `tests/time.csv`, both
+ * vanish at `(1, 2)`
+ */
+template<typename F> std::vector<MultivariatePolynomial<F>> powerSum(int n, int m) {
+    MultivariatePolynomial<F> a = defineVariable<F>('a');
+    MultivariatePolynomial<F> b = defineVariable<F>('b');
+
+    auto powerSum = [&](int k) {
+        return (a ^ k) + (b ^ k) - F(1 + (int64_t(1) << k));
+    };
+    return {powerSum(n), powerSum(m)};
+}
+
+/**
+ * @brief Univariate `(x - 1)(x - 2)...(x - n)`, all roots are simple and rational
+ */
+template<typename F> UnivariatePolynomial<F> wilkinson(int n) {
+    UnivariatePolynomial<F> f(F::one);
+    for (int k = 1; k <= n; k++) {
+        f = f * UnivariatePolynomial<F>(std::vector<F>{F(-k), F::one});
+    }
+    return f;
+}
+
+} //  namespace Systems
+
+#endif //  BENCH_SYSTEMS_HPP
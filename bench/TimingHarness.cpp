@@ -0,0 +1,400 @@
+#include "BigRational.hpp"
+#include "GaloisField.hpp"
+#include "GroebnerStats.hpp"
+#include "Logger.hpp"
+#include "Real.hpp"
+#include "Solver.hpp"
+#include "Systems.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+/**
+ * Reproducible successor of the timing run behind `tests/time.csv`. Solves the power-sum systems
+ * `X^n + Y^n - (1 + 2^n), X^m + Y^m - (1 + 2^m)` for a grid of degree pairs `n < m` and records
+ * wall time, peak resident memory, Groebner basis size and pair statistics of every case. The
+ * CSV keeps the columns of `tests/time.csv` in front, so old reports serve as baselines too.
+ *
+ * Usage: TimingHarness [--field BigRational|GaloisField|Real] [--min-degree 2] [--max-degree 13]
+ *                      [--max-product 20] [--repetitions 3] [--timeout-ms 60000] [--csv out.csv]
+ *                      [--json out.json] [--baseline time.csv] [--threshold 0.25] [--min-ms 5]
+ *
+ * With `--baseline` every case slower than `(1 + threshold)` times its baseline, and slower than
+ * `min-ms` in absolute terms, is reported as a regression and the exit code is 1. So is a case
+ * that ran into `--timeout-ms` where the baseline finished. Aborted baseline rows only record the
+ * time limit, they are not compared.
+ *
+ * `PeakRssScope` tells what `PeakRssKiB` covers: `case` where the peak can be reset before every
+ * run (Linux), `process` where only the high-water mark of the whole process is available and
+ * every case after the largest one reports that case's peak.
+ */
+
+namespace {
+
+struct Settings {
+    std::string field = "BigRational";
+    int minDegree = 2;
+    int maxDegree = 13;
+    int maxProduct = 20;
+    int repetitions = 3;
+    int timeoutMilliseconds = 60'000;
+    std::string csvPath;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 0.25;
+    double minMilliseconds = 5.0;
+};
+
+struct Measurement {
+    std::string polynomial1;
+    std::string polynomial2;
+    int n = 0;
+    int m = 0;
+    int64_t microseconds = 0;
+    int64_t peakRssKiB = 0;
+    std::string peakRssScope = "case";
+    std::string status;
+    GroebnerStats stats;
+};
+
+//  Resets `VmHWM` through `clear_refs` (Linux 4.0 and later), false where that is not possible
+bool resetPeakRss() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5" << std::flush;
+    return clearRefs.good();
+}
+
+/**
+ * @brief Peak resident set size. `VmHWM` after a successful `resetPeakRss` covers the current case
+ * only and sets `sinceReset`, otherwise the result is the high-water mark of the whole process.
+ */
+int64_t peakRssKiB(bool wasReset, bool& sinceReset) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            sinceReset = wasReset;
+            return std::stoll(line.substr(6));
+        }
+    }
+
+    sinceReset = false;
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+template<typename F> using RootFinder = std::vector<F> (*)(const UnivariatePolynomial<F>&);
+
+template<typename F>
+Measurement measure(int n, int m, RootFinder<F> rootFinder, const Settings& settings) {
+    const std::vector<MultivariatePolynomial<F>> system = Systems::powerSum<F>(n, m);
+
+    Measurement result;
+    result.polynomial1 = system[0].toString();
+    result.polynomial2 = system[1].toString();
+    result.n = n;
+    result.m = m;
+    result.microseconds = std::numeric_limits<int64_t>::max();
+
+    //  The fastest repetition is the least disturbed by the rest of the machine
+    for (int repetition = 0; repetition < settings.repetitions; repetition++) {
+        SolverOptions options;
+        options.budget =
+            ComputationBudget::withTimeout(std::chrono::milliseconds(settings.timeoutMilliseconds));
+        GroebnerStats stats;
+        options.stats = &stats;
+
+        const bool wasReset = resetPeakRss();
+        const auto start = std::chrono::steady_clock::now();
+        auto solution = solveSystem<F>(system, rootFinder, options);
+        const auto end = std::chrono::steady_clock::now();
+        const int64_t microseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        const bool aborted = std::holds_alternative<std::string>(solution) &&
+                             std::get<std::string>(solution).rfind("Computation aborted", 0) == 0;
+        result.status = aborted ? "aborted" : "ok";
+        bool sinceReset = false;
+        result.peakRssKiB = std::max(result.peakRssKiB, peakRssKiB(wasReset, sinceReset));
+        if (!sinceReset) {
+            result.peakRssScope = "process";
+        }
+        if (microseconds < result.microseconds) {
+            result.microseconds = microseconds;
+            result.stats = stats;
+        }
+
+        //  Repeating a case that ran into the time limit only repeats the limit
+        if (aborted) {
+            break;
+        }
+    }
+    return result;
+}
+
+template<typename F>
+std::vector<Measurement> runGrid(RootFinder<F> rootFinder, const Settings& settings) {
+    std::vector<std::pair<int, int>> grid;
+    for (int n = settings.minDegree; n <= settings.maxDegree; n++) {
+        for (int m = n + 1; m <= settings.maxDegree && n * m <= settings.maxProduct; m++) {
+            grid.push_back({n, m});
+        }
+    }
+
+    //  Same order as `tests/time.csv`: by product of the degrees, then by the smaller degree
+    std::sort(grid.begin(), grid.end(), [](const auto& a, const auto& b) {
+        return std::make_pair(a.first * a.second, a.first) <
+               std::make_pair(b.first * b.second, b.first);
+    });
+
+    std::vector<Measurement> measurements;
+    for (const auto& [n, m] : grid) {
+        measurements.push_back(measure<F>(n, m, rootFinder, settings));
+        const Measurement& last = measurements.back();
+        std::cerr << "n=" << n << " m=" << m << ": " << last.microseconds / 1000.0 << " ms, "
+                  << last.peakRssKiB << " KiB, basis " << last.stats.basisSize << " ("
+                  << last.status << ")" << std::endl;
+    }
+    return measurements;
+}
+
+void writeCsv(std::ostream& os, const std::vector<Measurement>& measurements) {
+    os << "Polynomial1,Polynomial2,n,m,Product,TimeMicroseconds,TimeMilliseconds,PeakRssKiB,"
+          "BasisSize,ReducedBasisSize,PairsConsidered,LcmSkipped,ChainSkipped,PairsReduced,"
+          "ZeroReductions,Status,PeakRssScope\n";
+    for (const Measurement& r : measurements) {
+        os << r.polynomial1 << "," << r.polynomial2 << "," << r.n << "," << r.m << ","
+           << r.n * r.m << "," << r.microseconds << "," << r.microseconds / 1000 << ","
+           << r.peakRssKiB << "," << r.stats.basisSize << "," << r.stats.reducedBasisSize << ","
+           << r.stats.pairsConsidered << "," << r.stats.lcmSkipped << ","
+           << r.stats.chainSkipped << "," << r.stats.pairsReduced << ","
+           << r.stats.zeroReductions << "," << r.status << "," << r.peakRssScope << "\n";
+    }
+}
+
+void writeJson(std::ostream& os, const std::vector<Measurement>& measurements) {
+    os << "[";
+    for (int i = 0; i < measurements.size(); i++) {
+        const Measurement& r = measurements[i];
+        os << (i > 0 ? ",\n " : "") << "{\"n\":" << r.n << ",\"m\":" << r.m
+           << ",\"timeMicroseconds\":" << r.microseconds << ",\"peakRssKiB\":" << r.peakRssKiB
+           << ",\"peakRssScope\":\"" << r.peakRssScope << "\",\"status\":\"" << r.status
+           << "\",\"groebner\":" << toJson(r.stats) << "}";
+    }
+    os << "]\n";
+}
+
+struct BaselineCase {
+    int64_t microseconds = 0;
+    //  Only the time limit was recorded, reports without `Status` count as finished
+    bool aborted = false;
+};
+
+/**
+ * @brief Reads `TimeMicroseconds` and `Status` of every `(n, m)` from a CSV report, columns are
+ * looked up by name in the header
+ */
+std::map<std::pair<int, int>, BaselineCase> readBaseline(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open baseline " + path);
+    }
+
+    auto split = [](const std::string& line) {
+        std::vector<std::string> cells;
+        std::stringstream ss(line);
+        std::string cell;
+        while (std::getline(ss, cell, ',')) {
+            cells.push_back(cell);
+        }
+        return cells;
+    };
+
+    std::string line;
+    std::getline(file, line);
+    const std::vector<std::string> header = split(line);
+    auto column = [&](const std::string& name, bool required = true) {
+        auto it = std::find(header.begin(), header.end(), name);
+        if (it == header.end()) {
+            if (required) {
+                throw std::runtime_error("Baseline has no column " + name);
+            }
+            return -1;
+        }
+        return static_cast<int>(it - header.begin());
+    };
+    const int nColumn = column("n");
+    const int mColumn = column("m");
+    const int timeColumn = column("TimeMicroseconds");
+    const int statusColumn = column("Status", false);
+
+    std::map<std::pair<int, int>, BaselineCase> baseline;
+    while (std::getline(file, line)) {
+        const std::vector<std::string> cells = split(line);
+        if (cells.size() <= std::max({nColumn, mColumn, timeColumn, statusColumn})) {
+            continue;
+        }
+        const std::pair<int, int> key = {std::stoi(cells[nColumn]), std::stoi(cells[mColumn])};
+        const BaselineCase current = {std::stoll(cells[timeColumn]),
+                                      statusColumn >= 0 && cells[statusColumn] == "aborted"};
+
+        //  Reports may repeat a case, the fastest finished run counts like in `measure`
+        auto [it, inserted] = baseline.emplace(key, current);
+        BaselineCase& kept = it->second;
+        if (!inserted && !current.aborted) {
+            kept.microseconds = kept.aborted ? current.microseconds
+                                             : std::min(kept.microseconds, current.microseconds);
+            kept.aborted = false;
+        }
+    }
+    return baseline;
+}
+
+//  Prints the comparison with the baseline and returns the number of regressions
+int compareWithBaseline(const std::vector<Measurement>& measurements, const Settings& settings) {
+    const std::map<std::pair<int, int>, BaselineCase> baseline =
+        readBaseline(settings.baselinePath);
+
+    int regressions = 0;
+    for (const Measurement& r : measurements) {
+        auto it = baseline.find({r.n, r.m});
+        if (it == baseline.end()) {
+            continue;
+        }
+
+        const double current = r.microseconds / 1000.0;
+        const double previous = it->second.microseconds / 1000.0;
+        const bool aborted = r.status == "aborted";
+
+        //  An aborted baseline holds no timing, only finishing now or not is worth reporting
+        if (it->second.aborted) {
+            std::cout << "unchecked  n=" << r.n << " m=" << r.m << ": aborted in the baseline, ";
+            if (aborted) {
+                std::cout << "still aborted\n";
+            }
+            else {
+                std::cout << "now " << current << " ms\n";
+            }
+            continue;
+        }
+
+        const double ratio = previous > 0.0 ? current / previous : 1.0;
+        const bool regressed = aborted || (current > previous * (1.0 + settings.threshold) &&
+                                           current - previous > settings.minMilliseconds);
+        regressions += regressed;
+
+        std::cout << (regressed ? "REGRESSION " : "ok         ") << "n=" << r.n << " m=" << r.m
+                  << ": " << previous << " ms -> " << current << " ms (x" << ratio << ")"
+                  << (aborted ? " aborted at the time limit" : "") << "\n";
+    }
+    std::cout << regressions << " regression(s) against " << settings.baselinePath << std::endl;
+    return regressions;
+}
+
+Settings parseArguments(int argc, char** argv) {
+    Settings settings;
+    for (int i = 1; i < argc; i++) {
+        const std::string key = argv[i];
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for " + key);
+        }
+        const std::string value = argv[++i];
+
+        if (key == "--field") {
+            settings.field = value;
+        }
+        else if (key == "--min-degree") {
+            settings.minDegree = std::stoi(value);
+        }
+        else if (key == "--max-degree") {
+            settings.maxDegree = std::stoi(value);
+        }
+        else if (key == "--max-product") {
+            settings.maxProduct = std::stoi(value);
+        }
+        else if (key == "--repetitions") {
+            settings.repetitions = std::max(std::stoi(value), 1);
+        }
+        else if (key == "--timeout-ms") {
+            settings.timeoutMilliseconds = std::stoi(value);
+        }
+        else if (key == "--csv") {
+            settings.csvPath = value;
+        }
+        else if (key == "--json") {
+            settings.jsonPath = value;
+        }
+        else if (key == "--baseline") {
+            settings.baselinePath = value;
+        }
+        else if (key == "--threshold") {
+            settings.threshold = std::stod(value);
+        }
+        else if (key == "--min-ms") {
+            settings.minMilliseconds = std::stod(value);
+        }
+        else {
+            throw std::invalid_argument("Unknown option " + key);
+        }
+    }
+    return settings;
+}
+
+} //  namespace
+
+int main(int argc, char** argv) {
+    Logger::setLevel(Logger::Level::Off);
+
+    try {
+        const Settings settings = parseArguments(argc, argv);
+
+        std::vector<Measurement> measurements;
+        if (settings.field == "BigRational") {
+            measurements = runGrid<BigRational>(findBigRationalRoots, settings);
+        }
+        else if (settings.field == "GaloisField") {
+            GaloisField::setPrime(32'003);
+            measurements = runGrid<GaloisField>(findGaloisFieldRoots, settings);
+        }
+        else if (settings.field == "Real") {
+            measurements = runGrid<Real>(findRealRoots, settings);
+        }
+        else {
+            throw std::invalid_argument("Unknown field " + settings.field);
+        }
+
+        if (!settings.csvPath.empty()) {
+            std::ofstream csv(settings.csvPath);
+            writeCsv(csv, measurements);
+        }
+        else {
+            writeCsv(std::cout, measurements);
+        }
+
+        if (!settings.jsonPath.empty()) {
+            std::ofstream json(settings.jsonPath);
+            writeJson(json, measurements);
+        }
+
+        if (!settings.baselinePath.empty() && compareWithBaseline(measurements, settings) > 0) {
+            return 1;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
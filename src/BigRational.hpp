@@ -431,6 +431,14 @@ public:
         return _denominator == 1;
     }
 
+    //  Bits of numerator and denominator together, a measure of coefficient growth
+    int bitLength() const {
+        auto bits = [](const BigInt& value) {
+            return value == 0 ? 0 : static_cast<int>(boost::multiprecision::msb(value)) + 1;
+        };
+        return bits(boost::multiprecision::abs(_numerator)) + bits(_denominator);
+    }
+
     const static BigRational zero;
     const static BigRational one;
 
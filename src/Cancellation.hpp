@@ -0,0 +1,127 @@
+#ifndef CANCELLATION_HPP
+#define CANCELLATION_HPP
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Why a computation stopped before completing
+ */
+enum class AbortReason {
+    Cancelled,
+    DeadlineExceeded,
+    BasisSizeExceeded,
+    PairLimitExceeded,
+    CoefficientBitsExceeded
+};
+
+inline std::string toString(AbortReason reason) {
+    switch (reason) {
+    case AbortReason::Cancelled:
+        return "cancelled";
+    case AbortReason::DeadlineExceeded:
+        return "deadline exceeded";
+    case AbortReason::BasisSizeExceeded:
+        return "basis size limit exceeded";
+    case AbortReason::PairLimitExceeded:
+        return "S-pair limit exceeded";
+    case AbortReason::CoefficientBitsExceeded:
+        return "coefficient size limit exceeded";
+    }
+    return "aborted";
+}
+
+/**
+ * @brief Thrown by long running computations that were cancelled or ran out of budget
+ */
+class OperationCancelled : public std::runtime_error {
+public:
+    explicit OperationCancelled(AbortReason reason = AbortReason::Cancelled)
+        : std::runtime_error("Operation aborted: " + toString(reason)), _reason(reason) { }
+
+    AbortReason reason() const {
+        return _reason;
+    }
+
+private:
+    AbortReason _reason;
+};
+
+/**
+ * @brief Shared flag used to ask running computations to stop early. Copies refer to the same
+ * flag, so a token handed to several threads is cancelled for all of them at once.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : _state(std::make_shared<_State>()) { }
+
+    void cancel() const { _state->cancelled.store(true, std::memory_order_relaxed); }
+
+    bool isCancelled() const {
+        for (const _State* state = _state.get(); state != nullptr; state = state->parent.get()) {
+            if (state->cancelled.load(std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //  Token cancelled together with this one, but which can also be cancelled on its own
+    CancellationToken child() const {
+        CancellationToken result;
+        result._state->parent = _state;
+        return result;
+    }
+
+    //  Throws `OperationCancelled` once the token is cancelled
+    void throwIfCancelled() const {
+        if (isCancelled()) {
+            throw OperationCancelled();
+        }
+    }
+
+private:
+    struct _State {
+        std::atomic<bool> cancelled{false};
+        std::shared_ptr<const _State> parent;
+    };
+
+    std::shared_ptr<_State> _state;
+};
+
+/**
+ * @brief Limits of a Groebner basis or solver call. Every limit is unbounded by default, the
+ * computation checks them periodically and aborts with the corresponding `AbortReason`.
+ */
+struct ComputationBudget {
+    using Clock = std::chrono::steady_clock;
+
+    std::optional<Clock::time_point> deadline;
+    int maxBasisSize = std::numeric_limits<int>::max();
+    int64_t maxPairs = std::numeric_limits<int64_t>::max();
+    int maxCoefficientBits = std::numeric_limits<int>::max();
+
+    CancellationToken cancellation;
+
+    //  Budget whose deadline is `timeout` from now
+    static ComputationBudget withTimeout(Clock::duration timeout) {
+        ComputationBudget budget;
+        budget.deadline = Clock::now() + timeout;
+        return budget;
+    }
+
+    //  Throws `OperationCancelled` on cancellation or once the deadline passed
+    void checkpoint() const {
+        cancellation.throwIfCancelled();
+        if (deadline && Clock::now() >= *deadline) {
+            throw OperationCancelled(AbortReason::DeadlineExceeded);
+        }
+    }
+};
+
+#endif //  CANCELLATION_HPP
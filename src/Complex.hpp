@@ -0,0 +1,225 @@
+#ifndef COMPLEX_HPP
+#define COMPLEX_HPP
+
+#include "Field.hpp"
+
+#include <cmath>
+#include <complex>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * Complex numbers `a + bi` stored as a pair of doubles. Like `Real`, equality is decided up to
+ * `Complex::epsilon`. The ordering is lexicographic on the real and then the imaginary part, it is
+ * not compatible with the field operations and only exists so that values can be sorted.
+ */
+class Complex : public Field<Complex> {
+public:
+    Complex(double re = 0.0, double im = 0.0) : _value(re, im) { }
+
+    Complex(std::complex<double> value) : _value(value) { }
+
+    Complex(const Complex& other) : _value(other._value) { }
+
+    Complex(const std::string& str) {
+        try {
+            size_t pos;
+            _value = std::stod(str, &pos);
+            if (pos != str.size()) {
+                throw std::invalid_argument("");
+            }
+        }
+        catch (const std::exception& e) {
+            throw std::invalid_argument("Not a float");
+        }
+    }
+
+    Complex operator+(const Complex& other) const override {
+        return Complex(_value + other._value);
+    }
+
+    Complex operator-(const Complex& other) const override {
+        return Complex(_value - other._value);
+    }
+
+    Complex operator*(const Complex& other) const override {
+        return Complex(_value * other._value);
+    }
+
+    Complex operator/(const Complex& other) const override {
+        if (other == Complex::zero) {
+            throw std::domain_error("Division by zero");
+        }
+        return Complex(_value / other._value);
+    }
+
+    Complex& operator+=(const Complex& other) override {
+        _value += other._value;
+        return *this;
+    }
+
+    Complex& operator-=(const Complex& other) override {
+        _value -= other._value;
+        return *this;
+    }
+
+    Complex& operator*=(const Complex& other) override {
+        _value *= other._value;
+        return *this;
+    }
+
+    Complex& operator/=(const Complex& other) override {
+        if (other == Complex::zero) {
+            throw std::domain_error("Division by zero");
+        }
+        _value /= other._value;
+        return *this;
+    }
+
+    Complex operator+() const override {
+        return *this;
+    }
+
+    Complex operator-() const override {
+        return Complex(-_value);
+    }
+
+    bool operator==(const Complex& other) const override {
+        return std::abs(_value - other._value) < Complex::epsilon;
+    }
+
+    bool operator!=(const Complex& other) const override {
+        return !(*this == other);
+    }
+
+    bool operator<(const Complex& other) const override {
+        if (*this == other) {
+            return false;
+        }
+        if (std::abs(_value.real() - other._value.real()) >= Complex::epsilon) {
+            return _value.real() < other._value.real();
+        }
+        return _value.imag() < other._value.imag();
+    }
+
+    bool operator<=(const Complex& other) const override {
+        return !(other < *this);
+    }
+
+    bool operator>(const Complex& other) const override {
+        return other < *this;
+    }
+
+    bool operator>=(const Complex& other) const override {
+        return !(*this < other);
+    }
+
+    Complex& operator=(const Complex& other) override {
+        _value = other._value;
+        return *this;
+    }
+
+    Complex additiveInverse() const override {
+        return Complex(-_value);
+    }
+
+    Complex multiplicativeInverse() const override {
+        if (std::abs(_value) < Complex::epsilon) {
+            throw std::domain_error("Zero has no multiplicative inverse");
+        }
+        return Complex(1.0 / _value);
+    }
+
+    std::string toString() const override {
+        bool hasReal = std::abs(_value.real()) >= Complex::epsilon;
+        bool hasImag = std::abs(_value.imag()) >= Complex::epsilon;
+
+        if (!hasImag) {
+            return hasReal ? _format(_value.real()) : "0";
+        }
+
+        std::string imag;
+        if (std::abs(_value.imag() - 1.0) < Complex::epsilon) {
+            imag = "i";
+        }
+        else if (std::abs(_value.imag() + 1.0) < Complex::epsilon) {
+            imag = "-i";
+        }
+        else {
+            imag = _format(_value.imag()) + "i";
+        }
+
+        if (!hasReal) {
+            return imag;
+        }
+        return "(" + _format(_value.real()) + (imag[0] == '-' ? "" : "+") + imag + ")";
+    }
+
+    Complex power(int64_t exp) const override {
+        if (exp == 0) {
+            return one;
+        }
+        if (exp < 0) {
+            return multiplicativeInverse().power(-exp);
+        }
+
+        std::complex<double> result = 1.0;
+        std::complex<double> base = _value;
+        while (exp > 0) {
+            if (exp & 1) {
+                result *= base;
+            }
+            base *= base;
+            exp >>= 1;
+        }
+        return Complex(result);
+    }
+
+    double real() const {
+        return _value.real();
+    }
+
+    double imag() const {
+        return _value.imag();
+    }
+
+    std::complex<double> getValue() const {
+        return _value;
+    }
+
+    //  Fixed precision, coefficients cannot grow
+    int bitLength() const {
+        return 128;
+    }
+
+    static void setEpsilon(double eps) {
+        epsilon = eps;
+    }
+
+    static double epsilon;
+
+    const static Complex zero;
+    const static Complex one;
+
+private:
+    std::complex<double> _value;
+
+    static std::string _format(double value) {
+        //  Check if value is close to an integer
+        double rounded = std::round(value);
+        if (std::abs(value - rounded) < Complex::epsilon) {
+            std::ostringstream oss;
+            oss << static_cast<int64_t>(rounded);
+            return oss.str();
+        }
+
+        std::ostringstream oss;
+        oss.precision(12);
+        oss << value;
+        return oss.str();
+    }
+};
+
+template<> inline constexpr bool isExactField<Complex> = false;
+
+#endif //  COMPLEX_HPP
@@ -24,12 +24,61 @@ using SystemResult__Rational = SystemResult<BigRational>;
 using SystemResult__GaloisField = SystemResult<GaloisField>;
 using SystemResult__Real = SystemResult<Real>;
 
+//  Wall time limit of a single request in milliseconds, `0` means unlimited
+int timeLimitMilliseconds = 0;
+
+void setTimeLimit(int milliseconds) {
+    timeLimitMilliseconds = std::max(milliseconds, 0);
+}
+
+ComputationBudget requestBudget() {
+    return timeLimitMilliseconds > 0 ?
+               ComputationBudget::withTimeout(std::chrono::milliseconds(timeLimitMilliseconds)) :
+               ComputationBudget();
+}
+
+//  JavaScript function called as `callback(current, total)` with the Groebner basis progress
+val progressCallback = val::undefined();
+
+void setProgressCallback(val callback) {
+    progressCallback = callback;
+}
+
+//  Reports come from the solver's pool threads, which is safe for `val` only because the solver
+//  runs on the calling thread here: the default `numThreads` is one and there are no pthreads
+ProgressReporter progressReporter([](int64_t current, int64_t total) {
+    if (!progressCallback.isUndefined() && !progressCallback.isNull()) {
+        progressCallback(static_cast<double>(current), static_cast<double>(total));
+    }
+});
+
+SolverOptions requestSolverOptions() {
+    SolverOptions options;
+    options.budget = requestBudget();
+    options.progress = &progressReporter;
+    return options;
+}
+
+template<typename F>
+std::map<char, MultivariatePolynomial<F>>
+    budgetedCharacteristicEquations(const std::vector<MultivariatePolynomial<F>>& X,
+                                    std::string& error) {
+    try {
+        return characteristicEquations(X, 1, requestBudget());
+    }
+    catch (const OperationCancelled& e) {
+        error = std::string("Computation aborted: ") + toString(e.reason());
+        return {};
+    }
+}
+
 std::string printCharacteristicEquations__Rational(
     const std::vector<MultivariatePolynomial<BigRational>>& X) {
 
-    auto solution = characteristicEquations(X);
+    std::string error = "No solutions found";
+    auto solution = budgetedCharacteristicEquations(X, error);
     if (solution.empty()) {
-        return "No solutions found";
+        return error;
     }
 
     auto lcm = [](const BigInt& a, const BigInt& b) -> BigInt {
@@ -52,18 +101,21 @@ std::string printCharacteristicEquations__Rational(
 
 std::string printCharacteristicEquations__GaloisField(
     const std::vector<MultivariatePolynomial<GaloisField>>& X) {
-    auto solution = characteristicEquations(X);
-    return solution.empty() ? "No solutions found" : printCharacteristicEquations(solution);
+    std::string error = "No solutions found";
+    auto solution = budgetedCharacteristicEquations(X, error);
+    return solution.empty() ? error : printCharacteristicEquations(solution);
 }
 
 std::string printCharacteristicEquations__Real(const std::vector<MultivariatePolynomial<Real>>& X) {
-    auto solution = characteristicEquations(X);
-    return solution.empty() ? "No solutions found" : printCharacteristicEquations(solution);
+    std::string error = "No solutions found";
+    auto solution = budgetedCharacteristicEquations(X, error);
+    return solution.empty() ? error : printCharacteristicEquations(solution);
 }
 
 std::string
     printSystemSolution__Rational(const std::vector<MultivariatePolynomial<BigRational>>& X) {
-    auto solution = solveSystem<BigRational>(X, findBigRationalRoots);
+    auto solution = solveSystem<BigRational>(X, findBigRationalRootsSquareFree,
+                                             requestSolverOptions());
     return std::holds_alternative<std::string>(solution) ?
                std::get<std::string>(solution) :
                printSolutions(std::get<std::vector<std::map<char, BigRational>>>(solution));
@@ -71,14 +123,15 @@ std::string
 
 std::string
     printSystemSolution__GaloisField(const std::vector<MultivariatePolynomial<GaloisField>>& X) {
-    auto solution = solveSystem<GaloisField>(X, findGaloisFieldRoots);
+    auto solution = solveSystem<GaloisField>(X, findGaloisFieldRootsSquareFree,
+                                             requestSolverOptions());
     return std::holds_alternative<std::string>(solution) ?
                std::get<std::string>(solution) :
                printSolutions(std::get<std::vector<std::map<char, GaloisField>>>(solution));
 }
 
 std::string printSystemSolution__Real(const std::vector<MultivariatePolynomial<Real>>& X) {
-    auto solution = solveSystem<Real>(X, findRealRoots);
+    auto solution = solveSystem<Real>(X, findRealRoots, requestSolverOptions());
     return std::holds_alternative<std::string>(solution) ?
                std::get<std::string>(solution) :
                printSolutions(std::get<std::vector<std::map<char, Real>>>(solution));
@@ -258,6 +311,9 @@ EMSCRIPTEN_BINDINGS(polynomial_solver) {
 
     class_<GaloisField>("GaloisField").class_function("setPrime", &GaloisField::setPrime);
 
+    function("setTimeLimit", &setTimeLimit);
+    function("setProgressCallback", &setProgressCallback);
+
     function("buildSystemFromStrings__Rational", &buildSystemFromStrings__Rational);
     function("buildSystemFromStrings__GaloisField", &buildSystemFromStrings__GaloisField);
     function("buildSystemFromStrings__Real", &buildSystemFromStrings__Real);
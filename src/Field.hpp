@@ -69,4 +69,10 @@ protected:
     Field& operator=(const Field&) = default;
 };
 
+/**
+ * @brief Whether equality in `F` is exact. Floating point fields compare up to an epsilon and
+ * specialize this to `false`, so algorithms relying on exact cancellation can avoid them.
+ */
+template<typename F> inline constexpr bool isExactField = true;
+
 #endif //  FIELD_HPP
\ No newline at end of file
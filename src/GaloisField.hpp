@@ -146,6 +146,15 @@ public:
         return _value;
     }
 
+    //  Elements never grow beyond the size of the prime
+    int bitLength() const {
+        int result = 0;
+        for (int64_t value = _value; value != 0; value >>= 1) {
+            result++;
+        }
+        return result;
+    }
+
     static bool setPrime(int64_t p) {
         if (p <= 1) {
             return false;
@@ -1,20 +1,44 @@
 #ifndef GROEBNER_BASIS_HPP
 #define GROEBNER_BASIS_HPP
 
+#include "Cancellation.hpp"
+#include "GroebnerStats.hpp"
+#include "HilbertSeries.hpp"
 #include "Logger.hpp"
 #include "Monomial.hpp"
 #include "MonomialOrders.hpp"
 #include "MultivariatePolynomial.hpp"
+#include "ProgressReporter.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+
+/**
+ * @brief Work done by `polynomialReduce`, accumulated over all calls sharing the counters
+ */
+struct ReductionCounters {
+    int64_t steps = 0;
+    int peakTerms = 0;
+};
 
 /**
  * @brief Division algorithm for multivariable polynomials. Size of quotient vector is equal to the
  * size of the divisor vector. In general Result depends on the order of elements in
  * `G` as well as the monomial order choosen.
  */
-template<typename F>
+template<typename F, typename Order>
 std::pair<std::vector<MultivariatePolynomial<F>>, MultivariatePolynomial<F>>
     polynomialReduce(const MultivariatePolynomial<F>& f,
-                     const std::vector<MultivariatePolynomial<F>>& G, const MonomialOrder& order) {
+                     const std::vector<MultivariatePolynomial<F>>& G, const Order& order,
+                     ReductionCounters* counters = nullptr) {
 
     const int n = G.size();
     MultivariatePolynomial<F> p(f);
@@ -41,36 +65,139 @@ std::pair<std::vector<MultivariatePolynomial<F>>, MultivariatePolynomial<F>>
             }
 
             F divisionCoefficient = p_leadingCoefficient / g_leadingCoefficient;
-            MultivariatePolynomial<F> divisionMonomialPolynomial({
-                {divisionMonomial, divisionCoefficient}
-            });
-
-            p -= divisionMonomialPolynomial * g;
-            Q[i] += divisionMonomialPolynomial;
+            p.addMulTerm(-divisionCoefficient, divisionMonomial, g);
+            Q[i].addTerm(divisionCoefficient, divisionMonomial);
             somethingDivided = true;
 
+            if (counters != nullptr) {
+                counters->steps++;
+                counters->peakTerms = std::max(counters->peakTerms, p.termCount());
+            }
+
             break;
         }
 
         //  Nothing divided so reduce p and update r
         if (!somethingDivided) {
-            MultivariatePolynomial<F> divisionMonomialPolynomial({
-                {p_leadingMonomial, p_leadingCoefficient}
-            });
-            p -= divisionMonomialPolynomial;
-            r += divisionMonomialPolynomial;
+            r.addTerm(p_leadingCoefficient, p_leadingMonomial);
+            p.addTerm(-p_leadingCoefficient, p_leadingMonomial);
         }
     }
 
     return {Q, r};
 }
 
+/**
+ * @brief Leading terms of a basis with a divisibility mask per leading monomial. Letters map to
+ * distinct bits, so a mask that is not a subset of the mask of `m` rules out a divisor of `m`
+ * without looking at the exponents.
+ */
+template<typename F> class LeadingTermIndex {
+public:
+    LeadingTermIndex() = default;
+
+    template<typename Order>
+    LeadingTermIndex(const std::vector<MultivariatePolynomial<F>>& G, const Order& order) {
+        for (const MultivariatePolynomial<F>& g : G) {
+            add(g, order);
+        }
+    }
+
+    template<typename Order> void add(const MultivariatePolynomial<F>& g, const Order& order) {
+        _monomials.push_back(g.leadingMonomial(order));
+        _coefficients.push_back(g.leadingCoefficient(order));
+        _masks.push_back(mask(_monomials.back()));
+    }
+
+    //  Bit of every variable occurring in `m`, `'A'` to `'Z'` and `'a'` to `'z'` do not collide
+    static uint64_t mask(const Monomial& m) {
+        uint64_t result = 0;
+        for (const auto& [var, _] : m.getMonomial()) {
+            result |= uint64_t(1) << (var & 63);
+        }
+        return result;
+    }
+
+    //  First element whose leading monomial divides `m`, `-1` if there is none
+    int findDivisor(const Monomial& m, int skip = -1) const {
+        const uint64_t m_mask = mask(m);
+        for (int i = 0; i < _masks.size(); i++) {
+            if ((_masks[i] & ~m_mask) == 0 && i != skip &&
+                _monomials[i].getDegree() <= m.getDegree() && Monomial::divides(m, _monomials[i])) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    const Monomial& leadingMonomial(int i) const {
+        return _monomials[i];
+    }
+
+    const F& leadingCoefficient(int i) const {
+        return _coefficients[i];
+    }
+
+    int size() const {
+        return _masks.size();
+    }
+
+private:
+    std::vector<Monomial> _monomials;
+    std::vector<F> _coefficients;
+    std::vector<uint64_t> _masks;
+};
+
+/**
+ * @brief Remainder of `f` on division by `G` without the quotients. `index` holds the leading
+ * terms of `G`, so the divisor search only reads masks and `G` itself is only read for the
+ * subtraction, which makes concurrent calls on the same `G` safe. `skip` leaves one element out.
+ */
+template<typename F, typename Order>
+MultivariatePolynomial<F> normalForm(MultivariatePolynomial<F> f,
+                                     const std::vector<MultivariatePolynomial<F>>& G,
+                                     const LeadingTermIndex<F>& index, const Order& order,
+                                     ReductionCounters* counters = nullptr, int skip = -1) {
+
+    MultivariatePolynomial<F> p(std::move(f));
+    MultivariatePolynomial<F> r;
+
+    while (!p.isZeroPolynomial()) {
+        const Monomial& p_leadingMonomial = p.leadingMonomial(order);
+        const F p_leadingCoefficient = p.leadingCoefficient(order);
+        const int i = index.findDivisor(p_leadingMonomial, skip);
+
+        if (i < 0) {
+            r.addTerm(p_leadingCoefficient, p_leadingMonomial);
+            p.addTerm(-p_leadingCoefficient, p_leadingMonomial);
+            continue;
+        }
+
+        p.addMulTerm(-(p_leadingCoefficient / index.leadingCoefficient(i)),
+                     p_leadingMonomial / index.leadingMonomial(i), G[i]);
+
+        if (counters != nullptr) {
+            counters->steps++;
+            counters->peakTerms = std::max(counters->peakTerms, p.termCount());
+        }
+    }
+    return r;
+}
+
+//  `normalForm` with an index built on the fly, for a single division by `G`
+template<typename F, typename Order>
+MultivariatePolynomial<F> normalForm(MultivariatePolynomial<F> f,
+                                     const std::vector<MultivariatePolynomial<F>>& G,
+                                     const Order& order, ReductionCounters* counters = nullptr) {
+    return normalForm(std::move(f), G, LeadingTermIndex<F>(G, order), order, counters);
+}
+
 /**
  * `S(f, g) = lcm(LM(f), LM(g)) * (f / LT(f)  - g / LT(g))`
  */
-template<typename F>
+template<typename F, typename Order>
 MultivariatePolynomial<F> syzygy(const MultivariatePolynomial<F>& f,
-                                 const MultivariatePolynomial<F>& g, const MonomialOrder& order) {
+                                 const MultivariatePolynomial<F>& g, const Order& order) {
 
     const Monomial& f_leadingMonomial = f.leadingMonomial(order);
     F f_leadingCoefficient = f.leadingCoefficient(order);
@@ -79,19 +206,15 @@ MultivariatePolynomial<F> syzygy(const MultivariatePolynomial<F>& f,
     F g_leadingCoefficient = g.leadingCoefficient(order);
 
     Monomial lcm = Monomial::lcm(f_leadingMonomial, g_leadingMonomial);
-    MultivariatePolynomial<F> u({
-        {lcm / f_leadingMonomial, F::one / f_leadingCoefficient}
-    });
-    MultivariatePolynomial<F> v({
-        {lcm / g_leadingMonomial, F::one / g_leadingCoefficient}
-    });
-
-    return u * f - v * g;
+    MultivariatePolynomial<F> s;
+    s.addMulTerm(F::one / f_leadingCoefficient, lcm / f_leadingMonomial, f);
+    s.addMulTerm(-(F::one / g_leadingCoefficient), lcm / g_leadingMonomial, g);
+    return s;
 }
 
-template<typename F>
+template<typename F, typename Order>
 bool chainCriterion(const Monomial& lcm_ab, const std::vector<MultivariatePolynomial<F>>& G,
-                    int startIdx, const MonomialOrder& order) {
+                    int startIdx, const Order& order) {
     for (int k = startIdx; k < G.size(); k++) {
         if (Monomial::divides(lcm_ab, G[k].leadingMonomial(order))) {
             return true;
@@ -101,200 +224,831 @@ bool chainCriterion(const Monomial& lcm_ab, const std::vector<MultivariatePolyno
 }
 
 /**
- * @brief Extends set `X` to a Groebner basis using Buchberger's algorithm
+ * @brief Tuning knobs of Buchberger's algorithm
  */
+struct GroebnerOptions {
+    //  Threads reducing S-pairs, `1` keeps the whole computation on the calling thread
+    int numThreads = 1;
+
+    //  Pool shared with the caller, replaces `numThreads` when set
+    ThreadPool* pool = nullptr;
+
+    //  Checked before every iteration and S-pair reduction
+    ComputationBudget budget;
+
+    //  Receives the pairs handled in each iteration, a console progress bar when not set
+    ProgressReporter* progress = nullptr;
+
+    //  Filled with the counters of the run when set, also if the budget runs out
+    GroebnerStats* stats = nullptr;
+};
+
+namespace GroebnerDetail {
+
+using Clock = std::chrono::steady_clock;
+
+inline double secondsBetween(Clock::time_point from, Clock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+//  Degree, coefficient size and term count of a new basis element
 template<typename F>
-std::vector<MultivariatePolynomial<F>>
-    extendToGroebnerBasis(const std::vector<MultivariatePolynomial<F>>& X,
-                          const MonomialOrder& order) {
+void recordBasisElement(GroebnerStats& stats, const MultivariatePolynomial<F>& g) {
+    stats.maxDegree = std::max(stats.maxDegree, g.totalDegree());
+    stats.maxCoefficientBits = std::max(stats.maxCoefficientBits, g.maxCoefficientBits());
+    stats.peakTerms = std::max(stats.peakTerms, g.termCount());
+}
 
-    std::vector<MultivariatePolynomial<F>> G = X;
-    Logger::groebnerBasis("📥 Initial basis size: " + std::to_string(X.size()));
+} //  namespace GroebnerDetail
+
+/**
+ * @brief Outcome of a Groebner basis computation under a `ComputationBudget`. If the budget ran
+ * out, `basis` holds the generators collected so far: they span the same ideal as the input but
+ * are not yet a Groebner basis.
+ */
+template<typename F> struct GroebnerResult {
+    std::vector<MultivariatePolynomial<F>> basis;
+    std::optional<AbortReason> abortReason;
+    GroebnerStats stats;
+
+    bool completed() const {
+        return !abortReason.has_value();
+    }
+};
+
+/**
+ * @brief Extends set `X` to a Groebner basis using Buchberger's algorithm. Within one iteration
+ * the S-pairs surviving both criteria only read `G`, so they are reduced in parallel when
+ * `options.numThreads > 1`. Remainders are appended in pair order, which keeps the result
+ * independent of the number of threads. Stops early once `options.budget` is exhausted. With a
+ * concrete `Order` type all monomial comparisons are direct calls.
+ */
+template<typename F, typename Order>
+GroebnerResult<F> tryExtendToGroebnerBasis(std::vector<MultivariatePolynomial<F>> X,
+                                           const Order& order,
+                                           const GroebnerOptions& options = {}) {
+
+    using GroebnerDetail::Clock;
+    using GroebnerDetail::secondsBetween;
+
+    const Clock::time_point startTime = Clock::now();
+    const ComputationBudget& budget = options.budget;
+    GroebnerResult<F> result;
+    GroebnerStats& stats = result.stats;
+
+    std::vector<MultivariatePolynomial<F>> G = std::move(X);
+    for (const MultivariatePolynomial<F>& g : G) {
+        GroebnerDetail::recordBasisElement(stats, g);
+    }
+    LOG_GROEBNER("📥 Initial basis size: " + std::to_string(G.size()));
     int iterationCount = 0;
 
-    while (true) {
-        iterationCount++;
-        const int n = G.size();
-        std::vector<MultivariatePolynomial<F>> H = G;
-        bool somethingAdded = false;
-
-        //  Statistics for this iteration
-        const int totalPairs = n * (n - 1) / 2;
-        int currentPair = 0;
-        int lcmSkipped = 0;
-        int chainSkipped = 0;
-        int divisionsPerformed = 0;
-        int newPolynomials = 0;
-
-        Logger::groebnerBasis("🔄 ITERATION #" + std::to_string(iterationCount));
-        Logger::groebnerBasis("   📊 Current basis size: " + std::to_string(n));
-        Logger::groebnerBasis("   🧪 Pairs to check: " + std::to_string(totalPairs));
-        Logger::printProgressBar(0, totalPairs);
-
-        //  Iterate over all pairs (i, j) in G
-        for (int i = 0; i < n; i++) {
-            for (int j = i + 1; j < n; j++) {
-                currentPair++;
-
-                const Monomial& i_monomial = G[i].leadingMonomial(order);
-                const Monomial& j_monomial = G[j].leadingMonomial(order);
-                Monomial lcm_ij = Monomial::lcm(i_monomial, j_monomial);
-
-                //  First check lcmCriterion. If `a, b ` are relativly prime, we don't need to
-                //  comput syzygy
-                if (lcm_ij == i_monomial * j_monomial) {
-                    lcmSkipped++;
-                    Logger::printProgressBar(currentPair, totalPairs);
-                    continue;
+    ThreadPool ownPool(options.pool ? 1 : options.numThreads);
+    ThreadPool& pool = options.pool ? *options.pool : ownPool;
+
+    ProgressReporter consoleProgress = ProgressReporter::console();
+    ProgressReporter& progress = options.progress ? *options.progress : consoleProgress;
+    //  Reductions started, checked against the budget, and reductions finished
+    std::atomic<int64_t> pairsReduced(0);
+    std::atomic<int64_t> reductionsFinished(0);
+    std::atomic<int64_t> reductionSteps(0);
+    std::atomic<int> peakTerms(0);
+
+    try {
+        while (true) {
+            budget.checkpoint();
+            iterationCount++;
+            const Clock::time_point iterationStart = Clock::now();
+            const int n = G.size();
+            bool somethingAdded = false;
+
+            //  Statistics for this iteration
+            const int totalPairs = n * (n - 1) / 2;
+            int lcmSkipped = 0;
+            int chainSkipped = 0;
+            int divisionsPerformed = 0;
+            int newPolynomials = 0;
+
+            LOG_GROEBNER("🔄 ITERATION #" + std::to_string(iterationCount));
+            LOG_GROEBNER("   📊 Current basis size: " + std::to_string(n));
+            LOG_GROEBNER("   🧪 Pairs to check: " + std::to_string(totalPairs));
+            progress.start(totalPairs);
+
+            //  Leading terms and the order keys of their monomials are cached lazily and without
+            //  locks, fill the caches before `G` is shared. The reductions then only read `G`
+            for (const MultivariatePolynomial<F>& g : G) {
+                g.leadingMonomial(order);
+            }
+            const LeadingTermIndex<F> index(G, order);
+
+            //  Iterate over all pairs (i, j) in G and keep those that need a division
+            std::vector<std::pair<int, int>> pairs;
+            for (int i = 0; i < n; i++) {
+                for (int j = i + 1; j < n; j++) {
+                    const Monomial& i_monomial = G[i].leadingMonomial(order);
+                    const Monomial& j_monomial = G[j].leadingMonomial(order);
+                    Monomial lcm_ij = Monomial::lcm(i_monomial, j_monomial);
+
+                    //  First check lcmCriterion. If `a, b ` are relativly prime, we don't need
+                    //  to comput syzygy
+                    if (lcm_ij == i_monomial * j_monomial) {
+                        lcmSkipped++;
+                        continue;
+                    }
+
+                    //  Second check chainCriterion. That occurs when there
+                    //  is a third monomial that divides the lcm of the two
+                    //  monomials
+                    if (chainCriterion(lcm_ij, G, j + 1, order)) {
+                        chainSkipped++;
+                        continue;
+                    }
+
+                    pairs.push_back({i, j});
                 }
+            }
 
-                //  Second check chainCriterion. That occurs when there
-                //  is a third monomial that divides the lcm of the two
-                //  monomials
-                if (chainCriterion(lcm_ij, G, j + 1, order)) {
-                    chainSkipped++;
-                    Logger::printProgressBar(currentPair, totalPairs);
-                    continue;
+            const Clock::time_point reductionStart = Clock::now();
+            stats.iterations = iterationCount;
+            stats.pairsConsidered += totalPairs;
+            stats.lcmSkipped += lcmSkipped;
+            stats.chainSkipped += chainSkipped;
+            stats.pairSelectionSeconds += secondsBetween(iterationStart, reductionStart);
+            stats.phases.push_back({"pair selection", iterationCount,
+                                    secondsBetween(startTime, iterationStart),
+                                    secondsBetween(iterationStart, reductionStart)});
+
+            //  Need to do division. Each pair writes only its own slot of `remainders`
+            std::vector<MultivariatePolynomial<F>> remainders(pairs.size());
+            progress.advance(lcmSkipped + chainSkipped);
+
+            pool.parallelFor(pairs.size(), [&](int k) {
+                budget.checkpoint();
+                if (pairsReduced.fetch_add(1) >= budget.maxPairs) {
+                    throw OperationCancelled(AbortReason::PairLimitExceeded);
                 }
 
-                //  Need to do division. If r is not 0, add it to H
+                const auto [i, j] = pairs[k];
                 MultivariatePolynomial<F> s = syzygy(G[i], G[j], order);
-                auto [_, r] = polynomialReduce(s, G, order);
+                ReductionCounters counters;
+                remainders[k] = normalForm(s, G, index, order, &counters);
 
+                reductionsFinished++;
+                reductionSteps += counters.steps;
+                int peak = peakTerms.load();
+                while (counters.peakTerms > peak &&
+                       !peakTerms.compare_exchange_weak(peak, counters.peakTerms)) {
+                }
+
+                if (budget.maxCoefficientBits < std::numeric_limits<int>::max() &&
+                    remainders[k].maxCoefficientBits() > budget.maxCoefficientBits) {
+                    throw OperationCancelled(AbortReason::CoefficientBitsExceeded);
+                }
+                progress.advance();
+            });
+            divisionsPerformed = pairs.size();
+
+            //  If r is not 0, add it to G. The pairs are done, nothing reads `G` concurrently
+            for (MultivariatePolynomial<F>& r : remainders) {
                 if (!r.isZeroPolynomial()) {
                     newPolynomials++;
-                    H.push_back(r);
+                    GroebnerDetail::recordBasisElement(stats, r);
+                    G.push_back(std::move(r));
                     somethingAdded = true;
                 }
-
-                Logger::printProgressBar(currentPair, totalPairs);
             }
-        }
+            stats.zeroReductions += divisionsPerformed - newPolynomials;
 
-        Logger::clearProgressBar();
+            const Clock::time_point iterationEnd = Clock::now();
+            stats.reductionSeconds += secondsBetween(reductionStart, iterationEnd);
+            stats.phases.push_back({"reduction", iterationCount,
+                                    secondsBetween(startTime, reductionStart),
+                                    secondsBetween(reductionStart, iterationEnd)});
+            stats.iterationStats.push_back({secondsBetween(startTime, iterationStart), n,
+                                            totalPairs, lcmSkipped, chainSkipped,
+                                            divisionsPerformed, newPolynomials});
+            progress.finish();
 
-        Logger::groebnerBasis("📈 ITERATION #" + std::to_string(iterationCount) + " STATISTICS:");
-        Logger::groebnerBasis("   🚫 LCM criterion skipped: " + std::to_string(lcmSkipped) +
-                              " pairs");
-        Logger::groebnerBasis("   ⛓️  Chain criterion skipped: " + std::to_string(chainSkipped) +
-                              " pairs");
-        Logger::groebnerBasis("   ➗ Divisions performed: " + std::to_string(divisionsPerformed) +
-                              " pairs");
-        Logger::groebnerBasis("   ➕ New polynomials added: " + std::to_string(newPolynomials));
+            LOG_GROEBNER("📈 ITERATION #" + std::to_string(iterationCount) + " STATISTICS:");
+            LOG_GROEBNER("   🚫 LCM criterion skipped: " + std::to_string(lcmSkipped) + " pairs");
+            LOG_GROEBNER("   ⛓️  Chain criterion skipped: " + std::to_string(chainSkipped) +
+                         " pairs");
+            LOG_GROEBNER("   ➗ Divisions performed: " + std::to_string(divisionsPerformed) +
+                         " pairs");
+            LOG_GROEBNER("   ➕ New polynomials added: " + std::to_string(newPolynomials));
 
-        if (totalPairs > 0) {
-            double skipPercentage = 100.0 * (lcmSkipped + chainSkipped) / totalPairs;
-            Logger::groebnerBasis(
-                "   📊 Total skip rate: " + std::to_string(static_cast<int>(skipPercentage)) + "%");
-        }
+            if (totalPairs > 0) {
+                double skipPercentage = 100.0 * (lcmSkipped + chainSkipped) / totalPairs;
+                LOG_GROEBNER("   📊 Total skip rate: " +
+                             std::to_string(static_cast<int>(skipPercentage)) + "%");
+            }
 
+            //  If something was added continue, otherwise return
+            if (!somethingAdded) {
+                LOG_GROEBNER("🎉 Groebner basis is complete!");
+                LOG_GROEBNER("📊 Final basis size: " + std::to_string(G.size()));
+                break;
+            }
 
-        //  If something was added, update G and continue, otherwise return
-        if (!somethingAdded) {
-            Logger::groebnerBasis("🎉 Groebner basis is complete!");
-            Logger::groebnerBasis("📊 Final basis size: " + std::to_string(H.size()));
-            return H;
+            if (G.size() > budget.maxBasisSize) {
+                throw OperationCancelled(AbortReason::BasisSizeExceeded);
+            }
+            LOG_GROEBNER("🐨 Not yet a Groebner basis, continuing iteration...");
         }
+    }
+    catch (const OperationCancelled& e) {
+        progress.finish();
+        LOG_GROEBNER("🛑 Groebner basis computation aborted: " + toString(e.reason()));
+        result.abortReason = e.reason();
+    }
 
-        Logger::groebnerBasis("🐨 Not yet a Groebner basis, continuing iteration...");
-        G = std::move(H);
+    stats.basisSize = G.size();
+    //  Also counts the finished reductions of a round that was aborted
+    stats.pairsReduced = reductionsFinished;
+    stats.reductionSteps = reductionSteps;
+    stats.peakTerms = std::max(stats.peakTerms, peakTerms.load());
+    stats.seconds = secondsBetween(startTime, Clock::now());
+    if (options.stats != nullptr) {
+        *options.stats = stats;
     }
+
+    result.basis = std::move(G);
+    return result;
 }
 
 /**
- * @brief Reduces a Groebner basis
+ * @brief Extends set `X` to a Groebner basis using Buchberger's algorithm. Throws
+ * `OperationCancelled` if `options.budget` runs out.
  */
-template<typename F>
+template<typename F, typename Order>
 std::vector<MultivariatePolynomial<F>>
-    reduceGroebnerBasis(const std::vector<MultivariatePolynomial<F>>& G, const MonomialOrder& order,
-                        bool normalizedCoefficients) {
+    extendToGroebnerBasis(std::vector<MultivariatePolynomial<F>> X,
+                          const Order& order, const GroebnerOptions& options = {}) {
 
-    std::vector<MultivariatePolynomial<F>> H;
-    H.reserve(G.size());
+    GroebnerResult<F> result = tryExtendToGroebnerBasis(std::move(X), order, options);
+    if (!result.completed()) {
+        throw OperationCancelled(*result.abortReason);
+    }
+    return std::move(result.basis);
+}
 
-    //  First pass: Remove polynomials whose leading terms are divisible by others
-    for (int i = 0; i < G.size(); i++) {
-        const MultivariatePolynomial<F>& g = G[i];
-        const Monomial& g_leadingMonomial = g.leadingMonomial(order);
+/**
+ * @brief Variant of `tryExtendToGroebnerBasis` for homogeneous `X` whose Hilbert series is known,
+ * e.g. from the leading monomials of a Groebner basis of the same ideal under another order.
+ * Pairs are reduced by ascending degree of their lcm. Once the leading monomials of a degree reach
+ * the dimension `hilbert` predicts, the remaining pairs of that degree would only reduce to zero
+ * and are skipped, and the computation ends as soon as the whole series matches. Reductions run
+ * on the calling thread. Throws `std::invalid_argument` if `X` is not homogeneous or `hilbert`
+ * does not belong to its ideal.
+ */
+template<typename F, typename Order>
+GroebnerResult<F> tryExtendToGroebnerBasisHilbertDriven(
+    std::vector<MultivariatePolynomial<F>> X, const Order& order,
+    const HilbertSeries& hilbert, const GroebnerOptions& options = {}) {
 
-        bool inLeadingTermsIdeal = false;
+    using GroebnerDetail::Clock;
+    using GroebnerDetail::secondsBetween;
 
-        //  Check against polynomials we've already kept
-        for (const MultivariatePolynomial<F>& h : H) {
-            if (Monomial::divides(g_leadingMonomial, h.leadingMonomial(order))) {
-                inLeadingTermsIdeal = true;
-                break;
+    for (const MultivariatePolynomial<F>& x : X) {
+        if (!x.isHomogeneous()) {
+            throw std::invalid_argument("Hilbert driven Groebner basis needs homogeneous input");
+        }
+    }
+
+    const Clock::time_point startTime = Clock::now();
+    const ComputationBudget& budget = options.budget;
+    GroebnerResult<F> result;
+    GroebnerStats& stats = result.stats;
+
+    std::vector<MultivariatePolynomial<F>> G;
+    G.reserve(X.size());
+    for (MultivariatePolynomial<F>& x : X) {
+        if (!x.isZeroPolynomial()) {
+            GroebnerDetail::recordBasisElement(stats, x);
+            G.push_back(std::move(x));
+        }
+    }
+    LOG_GROEBNER("📥 Initial basis size: " + std::to_string(G.size()));
+
+    ProgressReporter consoleProgress = ProgressReporter::console();
+    ProgressReporter& progress = options.progress ? *options.progress : consoleProgress;
+
+    //  Pairs by the degree of their lcm, every new element pairs with all earlier ones
+    std::map<int, std::vector<std::pair<int, int>>> pairsByDegree;
+    auto addPairs = [&](int j) {
+        const Monomial& j_monomial = G[j].leadingMonomial(order);
+        for (int i = 0; i < j; i++) {
+            const Monomial& i_monomial = G[i].leadingMonomial(order);
+            Monomial lcm_ij = Monomial::lcm(i_monomial, j_monomial);
+            stats.pairsConsidered++;
+            if (lcm_ij == i_monomial * j_monomial) {
+                stats.lcmSkipped++;
+                continue;
             }
+            pairsByDegree[lcm_ij.getDegree()].push_back({i, j});
         }
+    };
+    for (int j = 0; j < G.size(); j++) {
+        addPairs(j);
+    }
 
-        //  Check against remaining polynomials in G
-        if (!inLeadingTermsIdeal) {
-            for (int j = i + 1; j < G.size(); j++) {
-                if (Monomial::divides(g_leadingMonomial, G[j].leadingMonomial(order))) {
-                    inLeadingTermsIdeal = true;
+    //  Pair `(i, j)` is covered by lower degrees if some `k` has a leading monomial dividing the
+    //  lcm and the pairs `(i, k)`, `(j, k)` have strictly smaller lcms
+    auto chainSkips = [&](int i, int j, const Monomial& lcm_ij) {
+        for (int k = 0; k < G.size(); k++) {
+            const Monomial& k_monomial = G[k].leadingMonomial(order);
+            if (k == i || k == j || !Monomial::divides(lcm_ij, k_monomial)) {
+                continue;
+            }
+            if (Monomial::lcm(G[i].leadingMonomial(order), k_monomial) != lcm_ij &&
+                Monomial::lcm(G[j].leadingMonomial(order), k_monomial) != lcm_ij) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto inconsistent = [&]() {
+        progress.finish();
+        return std::invalid_argument("Hilbert series does not belong to the ideal of the input");
+    };
+
+    HilbertSeries series = HilbertSeries::ofLeadingMonomials(G, order, hilbert.numVariables());
+    LeadingTermIndex<F> index(G, order);
+    int iterationCount = 0;
+    ReductionCounters counters;
+
+    try {
+        while (!pairsByDegree.empty() && series != hilbert) {
+            budget.checkpoint();
+            iterationCount++;
+            const Clock::time_point iterationStart = Clock::now();
+
+            const int degree = pairsByDegree.begin()->first;
+            const std::vector<std::pair<int, int>> pairs = std::move(pairsByDegree.begin()->second);
+            pairsByDegree.erase(pairsByDegree.begin());
+
+            //  Leading monomials this degree still lacks, each new element adds exactly one
+            int64_t missing = series.dimension(degree) - hilbert.dimension(degree);
+            if (missing < 0) {
+                throw inconsistent();
+            }
+
+            LOG_GROEBNER("🔄 DEGREE " + std::to_string(degree) + ": " +
+                         std::to_string(pairs.size()) + " pairs, " + std::to_string(missing) +
+                         " leading monomials missing");
+            progress.start(pairs.size());
+
+            const int basisSize = G.size();
+            int64_t chainSkipped = 0;
+            int64_t pairsReduced = 0;
+            int64_t newPolynomials = 0;
+            for (int k = 0; k < pairs.size(); k++) {
+                if (missing == 0) {
+                    stats.hilbertSkipped += pairs.size() - k;
                     break;
                 }
+                budget.checkpoint();
+                if (stats.pairsReduced + pairsReduced >= budget.maxPairs) {
+                    throw OperationCancelled(AbortReason::PairLimitExceeded);
+                }
+
+                const auto [i, j] = pairs[k];
+                const Monomial lcm_ij = Monomial::lcm(G[i].leadingMonomial(order),
+                                                      G[j].leadingMonomial(order));
+                if (chainSkips(i, j, lcm_ij)) {
+                    chainSkipped++;
+                    progress.advance();
+                    continue;
+                }
+
+                MultivariatePolynomial<F> r =
+                    normalForm(syzygy(G[i], G[j], order), G, index, order, &counters);
+                pairsReduced++;
+                if (budget.maxCoefficientBits < std::numeric_limits<int>::max() &&
+                    r.maxCoefficientBits() > budget.maxCoefficientBits) {
+                    throw OperationCancelled(AbortReason::CoefficientBitsExceeded);
+                }
+
+                if (!r.isZeroPolynomial()) {
+                    GroebnerDetail::recordBasisElement(stats, r);
+                    G.push_back(std::move(r));
+                    index.add(G.back(), order);
+                    addPairs(G.size() - 1);
+                    newPolynomials++;
+                    missing--;
+                }
+                progress.advance();
+            }
+            progress.finish();
+
+            //  All pairs of the degree done, the leading monomials are complete up to it
+            if (missing > 0) {
+                throw inconsistent();
+            }
+            if (newPolynomials > 0) {
+                series = HilbertSeries::ofLeadingMonomials(G, order, hilbert.numVariables());
+            }
+
+            const Clock::time_point iterationEnd = Clock::now();
+            stats.iterations = iterationCount;
+            stats.chainSkipped += chainSkipped;
+            stats.pairsReduced += pairsReduced;
+            stats.zeroReductions += pairsReduced - newPolynomials;
+            stats.reductionSeconds += secondsBetween(iterationStart, iterationEnd);
+            stats.phases.push_back({"degree " + std::to_string(degree), iterationCount,
+                                    secondsBetween(startTime, iterationStart),
+                                    secondsBetween(iterationStart, iterationEnd)});
+            stats.iterationStats.push_back({secondsBetween(startTime, iterationStart), basisSize,
+                                            static_cast<int64_t>(pairs.size()), 0, chainSkipped,
+                                            pairsReduced, newPolynomials});
+
+            if (G.size() > budget.maxBasisSize) {
+                throw OperationCancelled(AbortReason::BasisSizeExceeded);
             }
         }
 
-        if (!inLeadingTermsIdeal) {
-            H.push_back(g);
+        //  Without pairs left `G` is a Groebner basis, its series has to be the expected one
+        if (series != hilbert) {
+            throw inconsistent();
+        }
+        for (const auto& [_, pairs] : pairsByDegree) {
+            stats.hilbertSkipped += pairs.size();
         }
+        LOG_GROEBNER("🎉 Groebner basis is complete!");
+        LOG_GROEBNER("📊 Final basis size: " + std::to_string(G.size()) + ", " +
+                     std::to_string(stats.hilbertSkipped) + " pairs skipped by the Hilbert series");
+    }
+    catch (const OperationCancelled& e) {
+        progress.finish();
+        LOG_GROEBNER("🛑 Groebner basis computation aborted: " + toString(e.reason()));
+        result.abortReason = e.reason();
     }
 
-    //  Second pass: Perform reductions
-    bool somethingReduced = true;
-    while (somethingReduced) {
-        somethingReduced = false;
+    stats.basisSize = G.size();
+    stats.reductionSteps = counters.steps;
+    stats.peakTerms = std::max(stats.peakTerms, counters.peakTerms);
+    stats.seconds = secondsBetween(startTime, Clock::now());
+    if (options.stats != nullptr) {
+        *options.stats = stats;
+    }
 
-        for (int i = 0; i < H.size(); i++) {
-            //  Create divisor set without H[i] - use indices to avoid copying
-            std::vector<int> divisorIndices;
-            divisorIndices.reserve(H.size() - 1);
-            for (int j = 0; j < H.size(); j++) {
-                if (j != i) {
-                    divisorIndices.push_back(j);
-                }
-            }
+    result.basis = std::move(G);
+    return result;
+}
 
-            //  Create temporary vector of divisors (unavoidable for polynomialReduce interface)
-            std::vector<MultivariatePolynomial<F>> divisors;
-            divisors.reserve(divisorIndices.size());
-            for (int idx : divisorIndices) {
-                divisors.push_back(H[idx]);
-            }
+/**
+ * @brief Hilbert driven variant of `extendToGroebnerBasis`. Throws `OperationCancelled` if
+ * `options.budget` runs out.
+ */
+template<typename F, typename Order>
+std::vector<MultivariatePolynomial<F>>
+    extendToGroebnerBasisHilbertDriven(std::vector<MultivariatePolynomial<F>> X,
+                                       const Order& order, const HilbertSeries& hilbert,
+                                       const GroebnerOptions& options = {}) {
+
+    GroebnerResult<F> result =
+        tryExtendToGroebnerBasisHilbertDriven(std::move(X), order, hilbert, options);
+    if (!result.completed()) {
+        throw OperationCancelled(*result.abortReason);
+    }
+    return std::move(result.basis);
+}
+
+/**
+ * @brief Reduces a Groebner basis in place. After dropping the elements whose leading monomial
+ * is divisible by another one, the rest is visited by increasing leading monomial: a divisor of
+ * a term is never larger than the term, so only the elements visited before can reduce the tail
+ * and one pass against them, already reduced, suffices. The result keeps the order of `G`.
+ */
+template<typename F, typename Order>
+std::vector<MultivariatePolynomial<F>>
+    reduceGroebnerBasis(std::vector<MultivariatePolynomial<F>> G, const Order& order,
+                        bool normalizedCoefficients) {
+
+    //  Positions by increasing leading monomial, the last of equal leading monomials first
+    std::vector<int> positions;
+    positions.reserve(G.size());
+    for (int i = 0; i < G.size(); i++) {
+        if (!G[i].isZeroPolynomial()) {
+            positions.push_back(i);
+        }
+    }
+    std::sort(positions.begin(), positions.end(), [&](int a, int b) {
+        const Monomial& a_leadingMonomial = G[a].leadingMonomial(order);
+        const Monomial& b_leadingMonomial = G[b].leadingMonomial(order);
+        if (a_leadingMonomial == b_leadingMonomial) {
+            return a > b;
+        }
+        return order.compare(a_leadingMonomial, b_leadingMonomial);
+    });
+
+    //  First pass: Keep the minimal leading monomials, only smaller ones can divide them
+    LeadingTermIndex<F> index;
+    std::vector<int> kept;
+    kept.reserve(positions.size());
+    for (int position : positions) {
+        if (index.findDivisor(G[position].leadingMonomial(order)) < 0) {
+            index.add(G[position], order);
+            kept.push_back(position);
+        }
+    }
 
-            auto [_, r] = polynomialReduce(H[i], divisors, order);
+    //  Second pass: Tail-reduce by the elements before, the index grows along with `H`
+    std::vector<MultivariatePolynomial<F>> H;
+    H.reserve(kept.size());
+    index = LeadingTermIndex<F>();
+    for (int position : kept) {
+        H.push_back(normalForm(std::move(G[position]), H, index, order));
+        index.add(H.back(), order);
+    }
 
-            if (!r.isZeroPolynomial() && H[i] != r) {
-                H[i] = std::move(r);
-                somethingReduced = true;
+    //  Back to the order of `G`
+    std::vector<bool> isKept(G.size(), false);
+    for (int k = 0; k < kept.size(); k++) {
+        G[kept[k]] = std::move(H[k]);
+        isKept[kept[k]] = true;
+    }
+    int size = 0;
+    for (int i = 0; i < G.size(); i++) {
+        if (isKept[i]) {
+            if (size != i) {
+                G[size] = std::move(G[i]);
             }
+            size++;
         }
     }
+    G.resize(size);
 
     //  Third [optional] pass: Normalize coefficients
     if (normalizedCoefficients) {
-        for (MultivariatePolynomial<F>& h : H) {
-            F leadingCoefficient = h.leadingCoefficient(order);
-            h *= F::one / leadingCoefficient;
+        for (MultivariatePolynomial<F>& g : G) {
+            F leadingCoefficient = g.leadingCoefficient(order);
+            g *= F::one / leadingCoefficient;
         }
     }
 
-    Logger::groebnerBasis("🎉 Groebner basis reduction complete");
-    Logger::groebnerBasis("📊 Reduced basis size: " + std::to_string(H.size()));
-    return H;
+    LOG_GROEBNER("🎉 Groebner basis reduction complete");
+    LOG_GROEBNER("📊 Reduced basis size: " + std::to_string(G.size()));
+    return G;
 }
 
 /**
  * @brief Calculates the reduced Groebner basis of a set of polynomials
  */
-template<typename F>
+template<typename F, typename Order>
+std::vector<MultivariatePolynomial<F>>
+    calculateGroebnerBasis(std::vector<MultivariatePolynomial<F>> X,
+                           const Order& order, bool normalizedCoefficients = true,
+                           const GroebnerOptions& options = {}) {
+    GroebnerResult<F> result =
+        tryCalculateGroebnerBasis(std::move(X), order, normalizedCoefficients, options);
+    if (!result.completed()) {
+        throw OperationCancelled(*result.abortReason);
+    }
+    return std::move(result.basis);
+}
+
+/**
+ * @brief Calculates the reduced Groebner basis of a set of polynomials within `options.budget`.
+ * Never throws on an exhausted budget, the result reports the reason and the partial basis.
+ */
+template<typename F, typename Order>
+GroebnerResult<F> tryCalculateGroebnerBasis(std::vector<MultivariatePolynomial<F>> X,
+                                            const Order& order,
+                                            bool normalizedCoefficients = true,
+                                            const GroebnerOptions& options = {}) {
+    using GroebnerDetail::Clock;
+    using GroebnerDetail::secondsBetween;
+
+    GroebnerResult<F> result = tryExtendToGroebnerBasis(std::move(X), order, options);
+    if (!result.completed()) {
+        return result;
+    }
+
+    const Clock::time_point start = Clock::now();
+    result.basis = reduceGroebnerBasis(std::move(result.basis), order, normalizedCoefficients);
+
+    GroebnerStats& stats = result.stats;
+    const double duration = secondsBetween(start, Clock::now());
+    stats.reducedBasisSize = result.basis.size();
+    stats.interreductionSeconds = duration;
+    stats.phases.push_back({"interreduction", stats.iterations, stats.seconds, duration});
+    stats.seconds += duration;
+    if (options.stats != nullptr) {
+        *options.stats = stats;
+    }
+    return result;
+}
+
+/**
+ * @brief Converts the homogeneous Groebner basis `G` with respect to `source` into the reduced
+ * Groebner basis with respect to `target`. The Hilbert series of the leading monomials under
+ * `source` tells the Hilbert driven Buchberger algorithm when each degree is complete. Throws
+ * `std::invalid_argument` if `G` is not homogeneous and `OperationCancelled` if `options.budget`
+ * runs out.
+ */
+template<typename F, typename Source, typename Target>
 std::vector<MultivariatePolynomial<F>>
-    calculateGroebnerBasis(const std::vector<MultivariatePolynomial<F>>& X,
-                           const MonomialOrder& order, bool normalizedCoefficients = true) {
-    std::vector<MultivariatePolynomial<F>> G = extendToGroebnerBasis(X, order);
-    return reduceGroebnerBasis(G, order, normalizedCoefficients);
+    convertGroebnerBasis(const std::vector<MultivariatePolynomial<F>>& G, const Source& source,
+                         const Target& target, bool normalizedCoefficients = true,
+                         const GroebnerOptions& options = {}) {
+
+    const HilbertSeries hilbert = HilbertSeries::ofLeadingMonomials(G, source);
+    return reduceGroebnerBasis(extendToGroebnerBasisHilbertDriven(G, target, hilbert, options),
+                               target, normalizedCoefficients);
 }
 
+/**
+ * @brief Groebner basis of a growing ideal. Keeps the reduced basis, the S-pairs still to reduce
+ * and the counters of all runs, so `addGenerator` only pairs the new element with the basis
+ * instead of starting over from the raw generators. Pairs are reduced on the calling thread by
+ * ascending degree of their lcm, only `budget` and `stats` of the options are used.
+ */
+template<typename F, typename Order = LexOrder> class GroebnerBasis {
+public:
+    explicit GroebnerBasis(Order order, GroebnerOptions options = {})
+        : _order(std::move(order)), _options(std::move(options)) { }
+
+    GroebnerBasis(const std::vector<MultivariatePolynomial<F>>& generators, Order order,
+                  GroebnerOptions options = {})
+        : GroebnerBasis(std::move(order), std::move(options)) {
+        addGenerators(generators);
+    }
+
+    /**
+     * @brief Adds `f` to the ideal and returns whether the ideal grew. Throws `OperationCancelled`
+     * if `options.budget` runs out, the pairs left over are reduced by the next call.
+     */
+    bool addGenerator(const MultivariatePolynomial<F>& f) {
+        _complete();
+        if (!_append(normalForm(f, _basis, _index, _order, &_counters))) {
+            return false;
+        }
+        _complete();
+        return true;
+    }
+
+    //  Adds all of `generators` before reducing any pair
+    void addGenerators(const std::vector<MultivariatePolynomial<F>>& generators) {
+        for (const MultivariatePolynomial<F>& f : generators) {
+            _append(normalForm(f, _basis, _index, _order, &_counters));
+        }
+        _complete();
+    }
+
+    /**
+     * @brief Reduced Groebner basis with normalized coefficients, completes the pairs left over
+     * by an exhausted budget first
+     */
+    const std::vector<MultivariatePolynomial<F>>& basis() {
+        _complete();
+        return _basis;
+    }
+
+    const Order& order() const {
+        return _order;
+    }
+
+    //  Counters accumulated over all generators added so far
+    const GroebnerStats& stats() const {
+        return _stats;
+    }
+
+private:
+    //  S-pair `(i, j)` with `i < j`, ordered by the degree of its lcm
+    struct Pair {
+        int degree;
+        int i;
+        int j;
+
+        bool operator<(const Pair& other) const {
+            return std::tie(degree, i, j) < std::tie(other.degree, other.i, other.j);
+        }
+    };
+
+    Order _order;
+    GroebnerOptions _options;
+    std::vector<MultivariatePolynomial<F>> _basis;
+    LeadingTermIndex<F> _index;
+    std::set<Pair> _pairs;
+    bool _reduced = true;
+    GroebnerStats _stats;
+    ReductionCounters _counters;
+
+    Monomial _lcm(int i, int j) const {
+        return Monomial::lcm(_basis[i].leadingMonomial(_order), _basis[j].leadingMonomial(_order));
+    }
+
+    bool _pending(int i, int j) const {
+        if (i > j) {
+            std::swap(i, j);
+        }
+        return _pairs.count({_lcm(i, j).getDegree(), i, j}) > 0;
+    }
+
+    //  Appends a remainder and queues its pairs with all earlier elements
+    bool _append(MultivariatePolynomial<F> g) {
+        if (g.isZeroPolynomial()) {
+            return false;
+        }
+
+        GroebnerDetail::recordBasisElement(_stats, g);
+        _basis.push_back(std::move(g));
+        _index.add(_basis.back(), _order);
+        _reduced = false;
+
+        const int j = _basis.size() - 1;
+        const Monomial& j_monomial = _basis[j].leadingMonomial(_order);
+        for (int i = 0; i < j; i++) {
+            const Monomial& i_monomial = _basis[i].leadingMonomial(_order);
+            Monomial lcm_ij = Monomial::lcm(i_monomial, j_monomial);
+            _stats.pairsConsidered++;
+            if (lcm_ij == i_monomial * j_monomial) {
+                _stats.lcmSkipped++;
+                continue;
+            }
+            _pairs.insert({lcm_ij.getDegree(), i, j});
+        }
+        return true;
+    }
+
+    //  Buchberger's criterion: some `k` divides the lcm and both its pairs are already done
+    bool _chainSkips(const Pair& pair, const Monomial& lcm_ij) const {
+        for (int k = 0; k < _basis.size(); k++) {
+            if (k != pair.i && k != pair.j &&
+                Monomial::divides(lcm_ij, _basis[k].leadingMonomial(_order)) &&
+                !_pending(pair.i, k) && !_pending(pair.j, k)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void _complete() {
+        if (_reduced) {
+            return;
+        }
+
+        const GroebnerDetail::Clock::time_point start = GroebnerDetail::Clock::now();
+        const ComputationBudget& budget = _options.budget;
+        try {
+            while (!_pairs.empty()) {
+                budget.checkpoint();
+                if (_stats.pairsReduced >= budget.maxPairs) {
+                    throw OperationCancelled(AbortReason::PairLimitExceeded);
+                }
+
+                //  Erased only once handled, so an exhausted budget leaves it queued
+                const Pair pair = *_pairs.begin();
+                const Monomial lcm_ij = _lcm(pair.i, pair.j);
+                if (_chainSkips(pair, lcm_ij)) {
+                    _stats.chainSkipped++;
+                    _pairs.erase(pair);
+                    continue;
+                }
+
+                MultivariatePolynomial<F> r = normalForm(
+                    syzygy(_basis[pair.i], _basis[pair.j], _order), _basis, _index, _order,
+                    &_counters);
+                if (budget.maxCoefficientBits < std::numeric_limits<int>::max() &&
+                    r.maxCoefficientBits() > budget.maxCoefficientBits) {
+                    throw OperationCancelled(AbortReason::CoefficientBitsExceeded);
+                }
+                _stats.pairsReduced++;
+                _pairs.erase(pair);
+                if (!_append(std::move(r))) {
+                    _stats.zeroReductions++;
+                }
+                if (_basis.size() > budget.maxBasisSize) {
+                    throw OperationCancelled(AbortReason::BasisSizeExceeded);
+                }
+            }
+        }
+        catch (const OperationCancelled& e) {
+            LOG_GROEBNER("🛑 Incremental Groebner basis aborted: " + toString(e.reason()));
+            _record(start);
+            throw;
+        }
+
+        //  No pairs are left, so the reduced basis is all later generators need to pair with
+        _stats.basisSize = _basis.size();
+        _basis = reduceGroebnerBasis(std::move(_basis), _order, true);
+        _index = LeadingTermIndex<F>(_basis, _order);
+        _reduced = true;
+        _stats.iterations++;
+        _stats.reducedBasisSize = _basis.size();
+        _record(start);
+    }
+
+    void _record(GroebnerDetail::Clock::time_point start) {
+        _stats.reductionSteps = _counters.steps;
+        _stats.peakTerms = std::max(_stats.peakTerms, _counters.peakTerms);
+        _stats.seconds += GroebnerDetail::secondsBetween(start, GroebnerDetail::Clock::now());
+        if (_options.stats != nullptr) {
+            *_options.stats = _stats;
+        }
+    }
+};
+
 #endif //  GROEBNER_BASIS_HPP
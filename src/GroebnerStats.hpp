@@ -0,0 +1,153 @@
+#ifndef GROEBNER_STATS_HPP
+#define GROEBNER_STATS_HPP
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Counters of a single run of Buchberger's algorithm. Times are wall clock seconds,
+ * `phases` and `iterationStats` are offset from the start of the computation.
+ */
+struct GroebnerStats {
+    //  Timed part of the computation, e.g. pair selection of one iteration
+    struct Phase {
+        std::string name;
+        int iteration = 0;
+        double start = 0.0;
+        double duration = 0.0;
+    };
+
+    //  Counters of a single iteration
+    struct Iteration {
+        double start = 0.0;
+        int basisSize = 0;
+        int64_t pairs = 0;
+        int64_t lcmSkipped = 0;
+        int64_t chainSkipped = 0;
+        int64_t pairsReduced = 0;
+        int64_t newPolynomials = 0;
+    };
+
+    int iterations = 0;
+    int64_t pairsConsidered = 0;
+    int64_t lcmSkipped = 0;
+    int64_t chainSkipped = 0;
+    int64_t pairsReduced = 0;
+    int64_t zeroReductions = 0;
+
+    //  Pairs of degrees whose leading monomials were already complete by the Hilbert series
+    int64_t hilbertSkipped = 0;
+
+    //  Single division steps performed inside all S-pair reductions
+    int64_t reductionSteps = 0;
+
+    int basisSize = 0;
+    int reducedBasisSize = 0;
+
+    //  Largest total degree, coefficient size and term count over all basis elements. Peak terms
+    //  also covers the intermediate polynomials of the reductions.
+    int maxDegree = 0;
+    int maxCoefficientBits = 0;
+    int peakTerms = 0;
+
+    double pairSelectionSeconds = 0.0;
+    double reductionSeconds = 0.0;
+    double interreductionSeconds = 0.0;
+    double seconds = 0.0;
+
+    std::vector<Phase> phases;
+    std::vector<Iteration> iterationStats;
+};
+
+namespace GroebnerStatsDetail {
+
+inline std::string escape(const std::string& s) {
+    std::string result;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+//  Seconds to the microseconds used by the trace event format
+inline int64_t micros(double seconds) {
+    return static_cast<int64_t>(seconds * 1e6);
+}
+
+} //  namespace GroebnerStatsDetail
+
+/**
+ * @brief All counters of `stats` as a JSON object
+ */
+inline std::string toJson(const GroebnerStats& stats) {
+    std::ostringstream os;
+    os << "{\"iterations\":" << stats.iterations
+       << ",\"pairsConsidered\":" << stats.pairsConsidered
+       << ",\"lcmSkipped\":" << stats.lcmSkipped << ",\"chainSkipped\":" << stats.chainSkipped
+       << ",\"pairsReduced\":" << stats.pairsReduced
+       << ",\"zeroReductions\":" << stats.zeroReductions
+       << ",\"hilbertSkipped\":" << stats.hilbertSkipped
+       << ",\"reductionSteps\":" << stats.reductionSteps << ",\"basisSize\":" << stats.basisSize
+       << ",\"reducedBasisSize\":" << stats.reducedBasisSize
+       << ",\"maxDegree\":" << stats.maxDegree
+       << ",\"maxCoefficientBits\":" << stats.maxCoefficientBits
+       << ",\"peakTerms\":" << stats.peakTerms
+       << ",\"pairSelectionSeconds\":" << stats.pairSelectionSeconds
+       << ",\"reductionSeconds\":" << stats.reductionSeconds
+       << ",\"interreductionSeconds\":" << stats.interreductionSeconds
+       << ",\"seconds\":" << stats.seconds << ",\"iterationStats\":[";
+
+    for (int i = 0; i < stats.iterationStats.size(); i++) {
+        const GroebnerStats::Iteration& it = stats.iterationStats[i];
+        os << (i > 0 ? "," : "") << "{\"start\":" << it.start << ",\"basisSize\":" << it.basisSize
+           << ",\"pairs\":" << it.pairs << ",\"lcmSkipped\":" << it.lcmSkipped
+           << ",\"chainSkipped\":" << it.chainSkipped << ",\"pairsReduced\":" << it.pairsReduced
+           << ",\"newPolynomials\":" << it.newPolynomials << "}";
+    }
+    os << "]}";
+    return os.str();
+}
+
+/**
+ * @brief Phases and per-iteration counters of `stats` in the Chrome trace event format, loadable
+ * in `chrome://tracing` or Perfetto
+ */
+inline std::string toChromeTrace(const GroebnerStats& stats) {
+    using GroebnerStatsDetail::escape;
+    using GroebnerStatsDetail::micros;
+
+    std::ostringstream os;
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&]() {
+        os << (first ? "" : ",");
+        first = false;
+    };
+
+    for (const GroebnerStats::Phase& phase : stats.phases) {
+        separator();
+        os << "{\"name\":\"" << escape(phase.name) << "\",\"cat\":\"groebner\",\"ph\":\"X\""
+           << ",\"ts\":" << micros(phase.start) << ",\"dur\":" << micros(phase.duration)
+           << ",\"pid\":1,\"tid\":1,\"args\":{\"iteration\":" << phase.iteration << "}}";
+    }
+
+    for (const GroebnerStats::Iteration& it : stats.iterationStats) {
+        separator();
+        os << "{\"name\":\"basis\",\"ph\":\"C\",\"ts\":" << micros(it.start)
+           << ",\"pid\":1,\"args\":{\"size\":" << it.basisSize << "}}";
+        separator();
+        os << "{\"name\":\"pairs\",\"ph\":\"C\",\"ts\":" << micros(it.start)
+           << ",\"pid\":1,\"args\":{\"reduced\":" << it.pairsReduced
+           << ",\"skipped\":" << it.lcmSkipped + it.chainSkipped << "}}";
+    }
+
+    os << "],\"displayTimeUnit\":\"ms\"}";
+    return os.str();
+}
+
+#endif //  GROEBNER_STATS_HPP
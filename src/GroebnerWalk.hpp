@@ -0,0 +1,343 @@
+#ifndef GROEBNER_WALK_HPP
+#define GROEBNER_WALK_HPP
+
+#include "GroebnerBasis.hpp"
+#include "Logger.hpp"
+#include "MonomialOrders.hpp"
+#include "MultivariatePolynomial.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace GroebnerWalkDetail {
+
+using Weight = std::vector<int64_t>;
+using Matrix = std::vector<std::vector<int64_t>>;
+
+inline __int128 gcd(__int128 a, __int128 b) {
+    a = a < 0 ? -a : a;
+    b = b < 0 ? -b : b;
+    while (b != 0) {
+        const __int128 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+//  `a · b`, throws `std::overflow_error` instead of wrapping around
+inline __int128 checkedMultiply(__int128 a, __int128 b) {
+    __int128 product;
+    if (__builtin_mul_overflow(a, b, &product)) {
+        throw std::overflow_error("Groebner walk weights overflow 128 bits");
+    }
+    return product;
+}
+
+//  `a + b`, throws `std::overflow_error` instead of wrapping around
+inline __int128 checkedAdd(__int128 a, __int128 b) {
+    __int128 sum;
+    if (__builtin_add_overflow(a, b, &sum)) {
+        throw std::overflow_error("Groebner walk weights overflow 128 bits");
+    }
+    return sum;
+}
+
+/**
+ * @brief Rows of `order` as weight vectors over `permutation`. Unless the rows alone decide every
+ * comparison, the lex tie break of `order` is appended as unit rows.
+ */
+inline Matrix alignedRows(const MatrixOrder& order, const std::vector<char>& permutation) {
+    const std::vector<char>& own = order.permutation();
+    if (!std::is_permutation(own.begin(), own.end(), permutation.begin(), permutation.end())) {
+        throw std::invalid_argument("Groebner walk orders must rank the same variables");
+    }
+
+    Matrix rows = order.matrix();
+    if (own == permutation && rows.size() >= own.size()) {
+        return rows;
+    }
+    for (int i = 0; i < own.size(); i++) {
+        rows.push_back(Weight(own.size(), 0));
+        rows.back()[i] = 1;
+    }
+    for (Weight& row : rows) {
+        Weight aligned(permutation.size());
+        for (int i = 0; i < own.size(); i++) {
+            const int rank = std::find(permutation.begin(), permutation.end(), own[i]) -
+                             permutation.begin();
+            aligned[rank] = row[i];
+        }
+        row = std::move(aligned);
+    }
+    return rows;
+}
+
+/**
+ * @brief Terms of `g` whose `weight` degree equals the one of its leading monomial under
+ * `order`, i.e. the initial form of `g` when `order` refines `weight`
+ */
+template<typename F>
+MultivariatePolynomial<F> initialForm(const MultivariatePolynomial<F>& g, const MatrixOrder& order,
+                                      const Weight& weight) {
+    const Monomial& leadingMonomial = g.leadingMonomial(order);
+    std::map<Monomial, F> terms;
+    for (const auto& [monomial, coefficient] : g.getCoefficients()) {
+        if (order.weightedDifference(weight, leadingMonomial, monomial) == 0) {
+            terms.emplace(monomial, coefficient);
+        }
+    }
+    return MultivariatePolynomial<F>(terms);
+}
+
+/**
+ * @brief First point `t` in `(0, 1]` of the segment `(1 - t) current + t target` at which the
+ * leading monomial of an element of `G` under `order` ties with another of its monomials, as the
+ * fraction `{numerator, denominator}`. Empty if the leading monomials stay leading up to `target`.
+ * Throws `std::overflow_error` if comparing two candidates would overflow 128 bits.
+ */
+template<typename F>
+std::optional<std::pair<__int128, __int128>>
+    nextCrossing(const std::vector<MultivariatePolynomial<F>>& G, const MatrixOrder& order,
+                 const Weight& current, const Weight& target) {
+
+    std::optional<std::pair<__int128, __int128>> best;
+    for (const MultivariatePolynomial<F>& g : G) {
+        const Monomial& leadingMonomial = g.leadingMonomial(order);
+        for (const auto& [monomial, coefficient] : g.getCoefficients()) {
+            const __int128 atTarget = order.weightedDifference(target, leadingMonomial, monomial);
+            if (atTarget >= 0) {
+                continue;
+            }
+
+            //  The order refines `current`, so the leading monomial weighs at least as much
+            const __int128 atCurrent =
+                order.weightedDifference(current, leadingMonomial, monomial);
+            if (atCurrent <= 0) {
+                continue;
+            }
+
+            const __int128 numerator = atCurrent;
+            const __int128 denominator = atCurrent - atTarget;
+            if (!best || checkedMultiply(numerator, best->second) <
+                             checkedMultiply(best->first, denominator)) {
+                best = {numerator, denominator};
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief `(1 - t) current + t target` for `t = numerator / denominator`, scaled to coprime
+ * integers. Throws `std::overflow_error` if an entry does not fit into 64 bits.
+ */
+inline Weight interpolate(const Weight& current, const Weight& target, __int128 numerator,
+                          __int128 denominator) {
+    const __int128 divisor = gcd(numerator, denominator);
+    numerator /= divisor;
+    denominator /= divisor;
+
+    std::vector<__int128> scaled(current.size());
+    __int128 common = 0;
+    for (int i = 0; i < current.size(); i++) {
+        scaled[i] = checkedAdd(checkedMultiply(denominator - numerator, current[i]),
+                               checkedMultiply(numerator, target[i]));
+        common = gcd(common, scaled[i]);
+    }
+
+    Weight result(current.size());
+    for (int i = 0; i < current.size(); i++) {
+        const __int128 entry = common > 1 ? scaled[i] / common : scaled[i];
+        if (entry > std::numeric_limits<int64_t>::max() ||
+            entry < std::numeric_limits<int64_t>::min()) {
+            throw std::overflow_error("Groebner walk weight does not fit into 64 bits");
+        }
+        result[i] = static_cast<int64_t>(entry);
+    }
+    return result;
+}
+
+//  `sum_k base^(r - 1 - k) rows_k`, empty if an entry outgrows 62 bits
+inline std::optional<Weight> combinedWeight(const Matrix& rows, __int128 base) {
+    const int n = rows.front().size();
+    std::vector<__int128> combined(n, 0);
+    for (const Weight& row : rows) {
+        for (int i = 0; i < n; i++) {
+            combined[i] = combined[i] * base + row[i];
+            if (combined[i] > std::numeric_limits<int64_t>::max() / 2 ||
+                combined[i] < std::numeric_limits<int64_t>::min() / 2) {
+                return std::nullopt;
+            }
+        }
+    }
+    return Weight(combined.begin(), combined.end());
+}
+
+//  Only positive weights give a well-ordering in front of other rows
+inline bool isPositive(const Weight& weight) {
+    return std::all_of(weight.begin(), weight.end(), [](int64_t w) { return w > 0; });
+}
+
+//  Whether `weight` alone picks the leading monomial under `order` of every element of `G`
+template<typename F>
+bool isInterior(const std::vector<MultivariatePolynomial<F>>& G, const MatrixOrder& order,
+                const Weight& weight) {
+    for (const MultivariatePolynomial<F>& g : G) {
+        const Monomial& leadingMonomial = g.leadingMonomial(order);
+        for (const auto& [monomial, coefficient] : g.getCoefficients()) {
+            if (monomial != leadingMonomial &&
+                order.weightedDifference(weight, leadingMonomial, monomial) <= 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Weight vector in the interior of the cone of `order` on `G`, the combined rows of
+ * `order` for the smallest power of two base that separates all leading monomials. All initial
+ * forms are then single terms, so the walk does not start with a Groebner basis of whole
+ * top-degree parts.
+ */
+template<typename F>
+Weight interiorWeight(const std::vector<MultivariatePolynomial<F>>& G, const MatrixOrder& order) {
+    Matrix rows = order.matrix();
+    const int n = order.permutation().size();
+    for (int i = 0; rows.size() < n; i++) {
+        rows.push_back(Weight(n, 0));
+        rows.back()[i] = 1;
+    }
+
+    for (__int128 base = 2;; base *= 2) {
+        const std::optional<Weight> weight = combinedWeight(rows, base);
+        if (!weight) {
+            throw std::overflow_error("Groebner walk weight does not fit into 64 bits");
+        }
+        if (isPositive(*weight) && isInterior(G, order, *weight)) {
+            return *weight;
+        }
+    }
+}
+
+} //  namespace GroebnerWalkDetail
+
+/**
+ * @brief Converts the reduced Groebner basis `G` with respect to `source` into the reduced
+ * Groebner basis of the same ideal with respect to `target` by the Groebner walk. A weight vector
+ * moves along a segment from the interior of the cone of `source` towards `target` and at every
+ * cone boundary only the initial forms, which are homogeneous for the weight and mostly
+ * binomials, need a new Groebner basis that is lifted back to the ideal. Unlike FGLM it works
+ * for positive-dimensional ideals too.
+ *
+ * The walk aims at the perturbed target weight `sum_k N^(r - 1 - k) row_k` instead of the first
+ * row of `target`, which for lex would make the last step a Groebner basis computation of the
+ * forms of highest degree in one variable. `N` starts above the degrees in `G` and doubles until
+ * the target weight picks the same leading monomials as `target`. Throws `OperationCancelled` if
+ * `options.budget` runs out and `std::overflow_error` if a weight outgrows 64 bit entries.
+ */
+template<typename F>
+std::vector<MultivariatePolynomial<F>>
+    groebnerWalk(std::vector<MultivariatePolynomial<F>> G, const MatrixOrder& source,
+                 const MatrixOrder& target, const GroebnerOptions& options = {}) {
+
+    using namespace GroebnerWalkDetail;
+
+    const std::vector<char>& permutation = source.permutation();
+    const Matrix targetRows = alignedRows(target, permutation);
+
+    //  Without variables there is only the constant monomial, any basis is already reduced
+    if (G.empty() || permutation.empty()) {
+        return G;
+    }
+
+    __int128 base = 2;
+    for (const MultivariatePolynomial<F>& g : G) {
+        base = std::max<__int128>(base, g.totalDegree() + 1);
+    }
+    auto nextTargetWeight = [&] {
+        for (;; base *= 2) {
+            const std::optional<Weight> weight = combinedWeight(targetRows, base);
+            if (!weight) {
+                throw std::overflow_error("Groebner walk weight does not fit into 64 bits");
+            }
+            if (isPositive(*weight)) {
+                return *weight;
+            }
+        }
+    };
+
+    //  The steps are small Groebner basis computations of their own, their counters would only
+    //  overwrite each other
+    GroebnerOptions stepOptions = options;
+    stepOptions.stats = nullptr;
+
+    MatrixOrder currentOrder = source;
+    Weight weight = interiorWeight(G, source);
+    std::vector<MultivariatePolynomial<F>> current = std::move(G);
+    Weight targetWeight = nextTargetWeight();
+    int steps = 0;
+
+    while (true) {
+        options.budget.checkpoint();
+
+        //  Order of the next cone: the current weight, ties broken towards the target weight
+        Matrix rows = {weight, targetWeight};
+        rows.insert(rows.end(), targetRows.begin(), targetRows.end());
+        const MatrixOrder nextOrder(std::move(rows), permutation);
+
+        std::vector<MultivariatePolynomial<F>> initialForms;
+        initialForms.reserve(current.size());
+        bool onlyTerms = true;
+        for (const MultivariatePolynomial<F>& g : current) {
+            initialForms.push_back(initialForm(g, currentOrder, weight));
+            onlyTerms = onlyTerms && initialForms.back().termCount() == 1;
+        }
+
+        //  With single-term initial forms the leading monomials do not change, `current` stays
+        //  the reduced basis
+        if (!onlyTerms) {
+            const std::vector<MultivariatePolynomial<F>> H =
+                calculateGroebnerBasis(initialForms, nextOrder, true, stepOptions);
+
+            //  `h - (h mod current)` lies in the ideal and keeps `h` as its initial form
+            const LeadingTermIndex<F> index(current, currentOrder);
+            std::vector<MultivariatePolynomial<F>> lifted;
+            lifted.reserve(H.size());
+            for (const MultivariatePolynomial<F>& h : H) {
+                lifted.push_back(h - normalForm(h, current, index, currentOrder));
+            }
+            current = reduceGroebnerBasis(std::move(lifted), nextOrder, true);
+        }
+        currentOrder = nextOrder;
+        steps++;
+
+        LOG_GROEBNER("🚶 Groebner walk step " + std::to_string(steps) + ": basis size " +
+                     std::to_string(current.size()));
+
+        if (weight == targetWeight) {
+            //  Equal leading monomials make `current` the reduced basis for `target` as well
+            const bool reachedTarget =
+                std::all_of(current.begin(), current.end(), [&](const auto& g) {
+                    //  Copy, the leading term cache of `g` holds one order at a time
+                    const Monomial leadingMonomial = g.leadingMonomial(target);
+                    return leadingMonomial == g.leadingMonomial(currentOrder);
+                });
+            if (reachedTarget) {
+                return current;
+            }
+            base *= 2;
+            targetWeight = nextTargetWeight();
+        }
+
+        const auto crossing = nextCrossing(current, currentOrder, weight, targetWeight);
+        weight = crossing ? interpolate(weight, targetWeight, crossing->first, crossing->second) :
+                            targetWeight;
+    }
+}
+
+#endif //  GROEBNER_WALK_HPP
@@ -0,0 +1,188 @@
+#ifndef HILBERT_SERIES_HPP
+#define HILBERT_SERIES_HPP
+
+#include "Monomial.hpp"
+#include "MultivariatePolynomial.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace HilbertSeriesDetail {
+
+using Polynomial = std::vector<int64_t>;
+
+inline void trim(Polynomial& p) {
+    while (!p.empty() && p.back() == 0) {
+        p.pop_back();
+    }
+}
+
+//  `p + factor t^shift q`
+inline Polynomial addShifted(Polynomial p, const Polynomial& q, int shift, int64_t factor = 1) {
+    p.resize(std::max(p.size(), q.size() + shift), 0);
+    for (int i = 0; i < q.size(); i++) {
+        p[i + shift] += factor * q[i];
+    }
+    trim(p);
+    return p;
+}
+
+//  Drops duplicates and generators divisible by others
+inline std::vector<Monomial> minimalGenerators(std::vector<Monomial> generators) {
+    std::sort(generators.begin(), generators.end(), [](const Monomial& a, const Monomial& b) {
+        return a.getDegree() < b.getDegree();
+    });
+
+    std::vector<Monomial> minimal;
+    for (const Monomial& g : generators) {
+        const bool redundant = std::any_of(minimal.begin(), minimal.end(), [&](const Monomial& m) {
+            return Monomial::divides(g, m);
+        });
+        if (!redundant) {
+            minimal.push_back(g);
+        }
+    }
+    return minimal;
+}
+
+/**
+ * @brief Numerator of the Hilbert series of `S / <generators>`. Pairwise coprime generators give
+ * `prod (1 - t^deg g)`. Otherwise a power `p = x^e` of the variable shared by most generators
+ * splits the ideal as `N(I) = N(I + <p>) + t^e N(I : p)`, both with smaller generators.
+ */
+inline Polynomial numerator(const std::vector<Monomial>& generators) {
+    const std::vector<Monomial> minimal = minimalGenerators(generators);
+
+    std::map<char, int> occurrences;
+    for (const Monomial& g : minimal) {
+        for (const auto& [var, _] : g.getMonomial()) {
+            occurrences[var]++;
+        }
+    }
+    const auto pivot = std::max_element(occurrences.begin(), occurrences.end(),
+                                        [](const auto& a, const auto& b) {
+                                            return a.second < b.second;
+                                        });
+
+    if (pivot == occurrences.end() || pivot->second == 1) {
+        Polynomial result = {1};
+        for (const Monomial& g : minimal) {
+            result = addShifted(result, result, g.getDegree(), -1);
+        }
+        return result;
+    }
+
+    //  Smallest exponent of the pivot among mixed generators, so `p` is not in the ideal yet
+    const char var = pivot->first;
+    int exponent = std::numeric_limits<int>::max();
+    for (const Monomial& g : minimal) {
+        if (g.getExponent(var) > 0 && g.getNumVariables() > 1) {
+            exponent = std::min(exponent, g.getExponent(var));
+        }
+    }
+
+    std::vector<Monomial> sum = minimal;
+    sum.push_back(Monomial(std::map<char, int>{{var, exponent}}));
+
+    std::vector<Monomial> quotient;
+    quotient.reserve(minimal.size());
+    for (const Monomial& g : minimal) {
+        std::map<char, int> exponents = g.getMonomial();
+        auto it = exponents.find(var);
+        if (it != exponents.end()) {
+            it->second -= std::min(it->second, exponent);
+            if (it->second == 0) {
+                exponents.erase(it);
+            }
+        }
+        quotient.push_back(Monomial(std::move(exponents)));
+    }
+
+    return addShifted(numerator(sum), numerator(quotient), exponent);
+}
+
+} //  namespace HilbertSeriesDetail
+
+/**
+ * @brief Hilbert series `H(t) = N(t) / (1 - t)^n` of `K[x_1, ..., x_n] / I` for a monomial ideal
+ * `I`. For a homogeneous ideal the series of its leading monomial ideal is the same for every
+ * monomial order, which lets a Groebner basis computation know in advance how many leading
+ * monomials each degree still lacks.
+ */
+class HilbertSeries {
+public:
+    HilbertSeries(const std::vector<Monomial>& generators, int numVariables)
+        : _numerator(HilbertSeriesDetail::numerator(generators)), _numVariables(numVariables) { }
+
+    /**
+     * @brief Series of the leading monomial ideal of `G` under `order`, over the variables of `G`
+     * unless `numVariables` says otherwise
+     */
+    template<typename F, typename Order>
+    static HilbertSeries ofLeadingMonomials(const std::vector<MultivariatePolynomial<F>>& G,
+                                            const Order& order, int numVariables = -1) {
+        std::vector<Monomial> leadingMonomials;
+        std::set<char> variables;
+        leadingMonomials.reserve(G.size());
+        for (const MultivariatePolynomial<F>& g : G) {
+            if (!g.isZeroPolynomial()) {
+                leadingMonomials.push_back(g.leadingMonomial(order));
+            }
+            for (char var : g.getVariables()) {
+                variables.insert(var);
+            }
+        }
+        return HilbertSeries(leadingMonomials,
+                             numVariables >= 0 ? numVariables : static_cast<int>(variables.size()));
+    }
+
+    //  Coefficients of `N(t)`, lowest degree first
+    const std::vector<int64_t>& numerator() const {
+        return _numerator;
+    }
+
+    int numVariables() const {
+        return _numVariables;
+    }
+
+    /**
+     * @brief Hilbert function, the number of monomials of total degree `degree` outside the ideal:
+     * `sum_i N_i binom(degree - i + n - 1, n - 1)`
+     */
+    int64_t dimension(int degree) const {
+        int64_t result = 0;
+        for (int i = 0; i < _numerator.size() && i <= degree; i++) {
+            result += _numerator[i] * _monomialCount(degree - i);
+        }
+        return result;
+    }
+
+    bool operator==(const HilbertSeries& other) const {
+        return _numVariables == other._numVariables && _numerator == other._numerator;
+    }
+
+    bool operator!=(const HilbertSeries& other) const {
+        return !(*this == other);
+    }
+
+private:
+    std::vector<int64_t> _numerator;
+    int _numVariables;
+
+    //  Monomials of total degree `degree` in `n` variables, `binom(degree + n - 1, n - 1)`
+    int64_t _monomialCount(int degree) const {
+        if (_numVariables == 0) {
+            return degree == 0 ? 1 : 0;
+        }
+        __int128 result = 1;
+        for (int k = 1; k < _numVariables; k++) {
+            result = result * (degree + k) / k;
+        }
+        return static_cast<int64_t>(result);
+    }
+};
+
+#endif //  HILBERT_SERIES_HPP
@@ -1,8 +1,10 @@
 #ifndef LOGGER_HPP
 #define LOGGER_HPP
 
+#include <atomic>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <string>
 
 class Logger {
@@ -38,26 +40,46 @@ public:
     constexpr static bool enabled_characteristicEq = ENABLE_CHARACTERISTIC_LOGGING;
     constexpr static bool enabled_progressBar = ENABLE_PROGRESS_BAR;
 
+    //  Runtime verbosity of the categories enabled at compile time
+    enum class Level { Off, Info, Debug };
+
+    static void setLevel(Level level) {
+        _level.store(level, std::memory_order_relaxed);
+    }
+
+    static Level getLevel() {
+        return _level.load(std::memory_order_relaxed);
+    }
+
+    static bool shouldLog(Level level) {
+        return level <= getLevel();
+    }
+
     static void groebnerBasis(const std::string& message) {
         if constexpr (enabled_groebnerBasis) {
-            std::cout << message << std::endl;
+            _write(message);
         }
     }
 
     static void solver(const std::string& message) {
         if constexpr (enabled_solver) {
-            std::cout << message << std::endl;
+            _write(message);
         }
     }
 
     static void characteristicEq(const std::string& message) {
         if constexpr (enabled_characteristicEq) {
-            std::cout << message << std::endl;
+            _write(message);
         }
     }
 
     static void printProgressBar(int current, int total, int barWidth = 50) {
         if constexpr (enabled_progressBar) {
+            if (!shouldLog(Level::Info)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_outputMutex);
             float progress = static_cast<float>(current) / total;
             int pos = static_cast<int>(barWidth * progress);
 
@@ -81,10 +103,46 @@ public:
 
     static void clearProgressBar() {
         if constexpr (enabled_progressBar) {
+            if (!shouldLog(Level::Info)) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_outputMutex);
             std::cout << "\r" << std::string(80, ' ') << "\r";
             std::cout.flush();
         }
     }
+
+private:
+    inline static std::atomic<Level> _level{Level::Debug};
+
+    //  Keeps lines of concurrent computations apart, progress bars also change stream formatting
+    inline static std::mutex _outputMutex;
+
+    static void _write(const std::string& message) {
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        std::cout << message << std::endl;
+    }
 };
 
-#endif //  LOGGER_HPP
\ No newline at end of file
+/**
+ * Logging macros evaluate their message only if the category is compiled in and the runtime
+ * level allows it, so disabled logging never formats a polynomial. The message may be any
+ * expression convertible to `std::string`, commas included.
+ */
+#define LOG_MESSAGE(category, level, ...)                                                         \
+    do {                                                                                           \
+        if constexpr (Logger::enabled_##category) {                                                \
+            if (Logger::shouldLog(Logger::Level::level)) {                                         \
+                Logger::category(__VA_ARGS__);                                                     \
+            }                                                                                      \
+        }                                                                                          \
+    } while (false)
+
+#define LOG_GROEBNER(...) LOG_MESSAGE(groebnerBasis, Info, __VA_ARGS__)
+#define LOG_SOLVER(...) LOG_MESSAGE(solver, Info, __VA_ARGS__)
+#define LOG_SOLVER_DEBUG(...) LOG_MESSAGE(solver, Debug, __VA_ARGS__)
+#define LOG_CHARACTERISTIC(...) LOG_MESSAGE(characteristicEq, Info, __VA_ARGS__)
+#define LOG_CHARACTERISTIC_DEBUG(...) LOG_MESSAGE(characteristicEq, Debug, __VA_ARGS__)
+
+#endif //  LOGGER_HPP
@@ -2,6 +2,7 @@
 #define MONOMIAL_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <ostream>
@@ -10,6 +11,32 @@
 #include <stdexcept>
 #include <vector>
 
+/**
+ * @brief 128 bit encoding of a monomial under a specific monomial order, comparing two keys of
+ * the same order compares the monomials. `valid` is false if the exponents do not fit.
+ */
+struct MonomialKey {
+    uint64_t high = 0;
+    uint64_t low = 0;
+    bool valid = true;
+
+    //  Flips the `width` bits at `shift` counted from the least significant bit of the key
+    void flip(uint64_t value, int shift, int width) {
+        if (shift >= 64) {
+            high ^= value << (shift - 64);
+            return;
+        }
+        low ^= value << shift;
+        if (shift + width > 64) {
+            high ^= value >> (64 - shift);
+        }
+    }
+
+    bool operator<(const MonomialKey& other) const {
+        return high != other.high ? high < other.high : low < other.low;
+    }
+};
+
 /**
  * @brief Monomial is stored as a map where each variable has its corresponding
  * exponent.
@@ -38,7 +65,8 @@ public:
     }
 
     Monomial(const Monomial& other)
-        : _monomial(other._monomial), _degree(other._degree), _numVariables(other._numVariables) { }
+        : _monomial(other._monomial), _degree(other._degree), _numVariables(other._numVariables),
+          _key(other._key), _keyOrderId(other._keyOrderId) { }
 
     explicit Monomial(const std::string& str) : _degree(0), _numVariables(0) {
         if (str.empty()) {
@@ -131,6 +159,23 @@ public:
         return (it != _monomial.end()) ? it->second : 0;
     }
 
+    /**
+     * @brief Key of this monomial under the order with id `orderId`. It is computed by
+     * `encode(*this)` on first use and kept until the monomial changes or another order asks.
+     * The cache is written without synchronization, so one monomial must not be compared on
+     * several threads at once unless its key for that order is already filled. Copying reads the
+     * cache too. Monomials shared between threads are therefore either only copied and divided, or
+     * their keys are filled before they are shared.
+     */
+    template<typename Encode>
+    const MonomialKey& orderKey(uint64_t orderId, const Encode& encode) const {
+        if (_keyOrderId != orderId) {
+            _key = encode(*this);
+            _keyOrderId = orderId;
+        }
+        return _key;
+    }
+
     bool operator==(const Monomial& other) const {
         return _monomial == other._monomial;
     }
@@ -204,6 +249,7 @@ public:
             _degree += exp;
         }
         _numVariables = _monomial.size();
+        _keyOrderId = 0;
         return *this;
     }
 
@@ -226,6 +272,7 @@ public:
     }
 
     Monomial& operator/=(const Monomial& other) {
+        _keyOrderId = 0;
         for (const auto& [var, exp] : other._monomial) {
 
             auto it = _monomial.find(var);
@@ -315,6 +362,10 @@ private:
     int _degree;
     int _numVariables;
 
+    //  Cached `orderKey`, id `0` belongs to no order
+    mutable MonomialKey _key;
+    mutable uint64_t _keyOrderId = 0;
+
     std::string _toSuperscript(int num) const {
         const static std::map<char, std::string> superscripts = {
             {'0', "⁰"},
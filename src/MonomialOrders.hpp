@@ -3,18 +3,166 @@
 
 #include "Monomial.hpp"
 
+#include <array>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <vector>
 
 /**
  *  Abstract class for the monomial ordering. Any derived class must implement the compare method
- * that returns the value of `a < b`
+ * that returns the value of `a < b`. The orders below are `final`, so code templated on the
+ * concrete order type (like the Groebner basis functions) calls `compare` directly and inlines it.
  */
 class MonomialOrder {
 public:
+    MonomialOrder() : _id(_nextId.fetch_add(1, std::memory_order_relaxed)) { }
     virtual ~MonomialOrder() = default;
     virtual bool compare(const Monomial& a, const Monomial& b) const = 0;
+
+    //  Identifies the order in the caches of monomials and polynomials, copies order alike and
+    //  share it
+    uint64_t id() const {
+        return _id;
+    }
+
+private:
+    uint64_t _id;
+    inline static std::atomic<uint64_t> _nextId{1};
+};
+
+/**
+ * @brief Position of every variable in the permutation of an order, `-1` for the variables the
+ * order ignores. Comparisons walk the exponents of both monomials once instead of looking up
+ * every variable of the permutation.
+ */
+class VariableRanks {
+public:
+    explicit VariableRanks(const std::vector<char>& permutation) {
+        _ranks.fill(-1);
+        for (int i = 0; i < permutation.size(); i++) {
+            int& rank = _ranks[static_cast<unsigned char>(permutation[i])];
+            rank = rank < 0 ? i : rank;
+        }
+    }
+
+    int operator[](char var) const {
+        return _ranks[static_cast<unsigned char>(var)];
+    }
+
+    /**
+     * @brief Calls `visit(rank, a_exp, b_exp)` for every ranked variable whose exponents in `a`
+     * and `b` differ, in the order of the variables rather than of their ranks
+     */
+    template<typename Visitor>
+    void forEachDifference(const Monomial& a, const Monomial& b, Visitor visit) const {
+        auto i = a.getMonomial().begin(), i_end = a.getMonomial().end();
+        auto j = b.getMonomial().begin(), j_end = b.getMonomial().end();
+
+        while (i != i_end || j != j_end) {
+            char var;
+            int a_exp = 0;
+            int b_exp = 0;
+            if (j == j_end || (i != i_end && i->first < j->first)) {
+                var = i->first;
+                a_exp = (i++)->second;
+            }
+            else if (i == i_end || j->first < i->first) {
+                var = j->first;
+                b_exp = (j++)->second;
+            }
+            else {
+                var = i->first;
+                a_exp = (i++)->second;
+                b_exp = (j++)->second;
+            }
+
+            const int rank = (*this)[var];
+            if (a_exp != b_exp && rank >= 0) {
+                visit(rank, a_exp, b_exp);
+            }
+        }
+    }
+
+    /**
+     * @brief Sign of `a_exp - b_exp` at the first variable of the permutation where the
+     * exponents of `a` and `b` differ, `0` if there is none
+     */
+    int compareExponents(const Monomial& a, const Monomial& b) const {
+        int firstRank = std::numeric_limits<int>::max();
+        int result = 0;
+        forEachDifference(a, b, [&](int rank, int a_exp, int b_exp) {
+            if (rank < firstRank) {
+                firstRank = rank;
+                result = a_exp < b_exp ? -1 : 1;
+            }
+        });
+        return result;
+    }
+
+private:
+    std::array<int, 256> _ranks;
+};
+
+/**
+ * @brief Builds the `MonomialKey` of an order: a prefix of `prefixBits` bits such as the degree,
+ * followed by the exponents in the order of the permutation. With `reversed` the exponents are
+ * complemented, so a larger exponent gives a smaller key. Every exponent gets the same share of
+ * the 128 bits, monomials with a larger exponent get an invalid key.
+ */
+class KeyEncoder {
+public:
+    KeyEncoder(const std::vector<char>& permutation, int prefixBits, bool reversed)
+        : _ranks(permutation), _prefixBits(prefixBits) {
+        const int numVariables = std::max<int>(permutation.size(), 1);
+        _exponentBits = std::min(32, (128 - prefixBits) / numVariables);
+        _maxExponent = (uint64_t(1) << _exponentBits) - 1;
+
+        for (int rank = 0; reversed && rank < permutation.size(); rank++) {
+            _empty.flip(_maxExponent, _shift(rank), _exponentBits);
+        }
+    }
+
+    const VariableRanks& ranks() const {
+        return _ranks;
+    }
+
+    MonomialKey encode(uint64_t prefix, const Monomial& m) const {
+        MonomialKey key = _empty;
+        if (_exponentBits == 0 || (_prefixBits < 64 && (prefix >> _prefixBits) != 0)) {
+            key.valid = false;
+            return key;
+        }
+        if (_prefixBits > 0) {
+            key.flip(prefix, 128 - _prefixBits, _prefixBits);
+        }
+
+        for (const auto& [var, exp] : m.getMonomial()) {
+            const int rank = _ranks[var];
+            if (rank < 0) {
+                continue;
+            }
+            if (exp > _maxExponent) {
+                key.valid = false;
+                return key;
+            }
+            key.flip(exp, _shift(rank), _exponentBits);
+        }
+        return key;
+    }
+
+private:
+    VariableRanks _ranks;
+    int _prefixBits;
+    int _exponentBits;
+    uint64_t _maxExponent;
+
+    //  Key of the monomial `1` without prefix
+    MonomialKey _empty;
+
+    int _shift(int rank) const {
+        return 128 - _prefixBits - (rank + 1) * _exponentBits;
+    }
 };
 
 /**
@@ -22,25 +170,28 @@ public:
  * decreasing order of the variables.
  *
  */
-class LexOrder : public MonomialOrder {
+class LexOrder final : public MonomialOrder {
 
 public:
-    explicit LexOrder(std::vector<char> permutation) : _permutation(std::move(permutation)) { }
+    explicit LexOrder(std::vector<char> permutation)
+        : _permutation(std::move(permutation)), _encoder(_permutation, 0, false) { }
 
     bool compare(const Monomial& a, const Monomial& b) const override {
-        for (char var : _permutation) {
-            int a_exp = a.getExponent(var);
-            int b_exp = b.getExponent(var);
-
-            if (a_exp != b_exp) {
-                return a_exp < b_exp;
-            }
+        const MonomialKey& a_key = _key(a);
+        const MonomialKey& b_key = _key(b);
+        if (a_key.valid && b_key.valid) {
+            return a_key < b_key;
         }
-        return false;
+        return _encoder.ranks().compareExponents(a, b) < 0;
     }
 
 private:
     std::vector<char> _permutation;
+    KeyEncoder _encoder;
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) { return _encoder.encode(0, m); });
+    }
 };
 
 /**
@@ -48,33 +199,37 @@ private:
  * the variables it uses to break degree ties.
  *
  */
-class GradedLexOrder : public MonomialOrder {
+class GradedLexOrder final : public MonomialOrder {
 
 public:
     explicit GradedLexOrder(std::vector<char> permutation)
-        : _permutation(std::move(permutation)) { }
+        : _permutation(std::move(permutation)), _encoder(_permutation, 32, false) { }
 
     bool compare(const Monomial& a, const Monomial& b) const override {
+        const MonomialKey& a_key = _key(a);
+        const MonomialKey& b_key = _key(b);
+        if (a_key.valid && b_key.valid) {
+            return a_key < b_key;
+        }
+
         int a_deg = a.getDegree();
         int b_deg = b.getDegree();
 
         if (a_deg != b_deg) {
             return a_deg < b_deg;
         }
-
-        for (char var : _permutation) {
-            int a_exp = a.getExponent(var);
-            int b_exp = b.getExponent(var);
-
-            if (a_exp != b_exp) {
-                return a_exp < b_exp;
-            }
-        }
-        return false;
+        return _encoder.ranks().compareExponents(a, b) < 0;
     }
 
 private:
     std::vector<char> _permutation;
+    KeyEncoder _encoder;
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) {
+            return _encoder.encode(m.getDegree(), m);
+        });
+    }
 };
 
 /**
@@ -82,83 +237,392 @@ private:
  * order of the variables it uses to break degree ties and it then reverses the outcome value.
  *
  */
-class GradedRevLexOrder : public MonomialOrder {
+class GradedRevLexOrder final : public MonomialOrder {
 
 public:
-    explicit GradedRevLexOrder(std::vector<char> perm) : _permutation(std::move(perm)) { }
+    explicit GradedRevLexOrder(std::vector<char> perm)
+        : _permutation(std::move(perm)), _encoder(_permutation, 32, true) { }
 
     bool compare(const Monomial& a, const Monomial& b) const override {
+        const MonomialKey& a_key = _key(a);
+        const MonomialKey& b_key = _key(b);
+        if (a_key.valid && b_key.valid) {
+            return a_key < b_key;
+        }
+
         int a_deg = a.getDegree();
         int b_deg = b.getDegree();
 
         if (a_deg != b_deg) {
             return a_deg < b_deg;
         }
+        return _encoder.ranks().compareExponents(a, b) > 0;
+    }
+
+private:
+    std::vector<char> _permutation;
+    KeyEncoder _encoder;
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) {
+            return _encoder.encode(m.getDegree(), m);
+        });
+    }
+};
+
+/**
+ * @brief Uses dot product with the non-negative integral `weights` and lex order specified by the
+ * `permutation` to break ties. Weighted degrees are exact, rational weights are scaled by the
+ * common denominator of their entries beforehand. The weighted degree is the 64 bit prefix of the
+ * cached key, so most comparisons are two word comparisons.
+ *
+ */
+class WeightedOrder final : public MonomialOrder {
+
+public:
+    explicit WeightedOrder(std::vector<int64_t> weights, std::vector<char> perm)
+        : _weights(std::move(weights)), _permutation(std::move(perm)),
+          _encoder(_permutation, 64, false) {
+        if (_weights.size() != _permutation.size()) {
+            throw std::invalid_argument("Weights and permutation must have the same size");
+        }
+        for (int64_t w : _weights) {
+            if (w < 0) {
+                throw std::invalid_argument("Weights must be non-negative");
+            }
+        }
+    }
+
+    bool compare(const Monomial& a, const Monomial& b) const override {
+        const MonomialKey& a_key = _key(a);
+        const MonomialKey& b_key = _key(b);
+        if (a_key.valid && b_key.valid) {
+            return a_key < b_key;
+        }
 
-        for (char var : _permutation) {
-            int a_exp = a.getExponent(var);
-            int b_exp = b.getExponent(var);
+        //  Products of a weight and an exponent stay below 2^94, so the sum is exact
+        const VariableRanks& ranks = _encoder.ranks();
+        __int128 difference = 0;
+        ranks.forEachDifference(a, b, [&](int rank, int a_exp, int b_exp) {
+            difference += static_cast<__int128>(_weights[rank]) * (a_exp - b_exp);
+        });
 
-            if (a_exp != b_exp) {
-                return a_exp > b_exp;
+        if (difference != 0) {
+            return difference < 0;
+        }
+        return ranks.compareExponents(a, b) < 0;
+    }
+
+    const std::vector<int64_t>& weights() const {
+        return _weights;
+    }
+
+    //  Weighted degree of `m`, variables outside of the permutation weigh nothing
+    unsigned __int128 weightedDegree(const Monomial& m) const {
+        unsigned __int128 result = 0;
+        for (const auto& [var, exp] : m.getMonomial()) {
+            const int rank = _encoder.ranks()[var];
+            if (rank >= 0) {
+                result += static_cast<unsigned __int128>(_weights[rank]) * exp;
             }
         }
-        return true;
+        return result;
     }
 
 private:
+    std::vector<int64_t> _weights;
     std::vector<char> _permutation;
+    KeyEncoder _encoder;
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) {
+            const unsigned __int128 degree = weightedDegree(m);
+            if (degree > std::numeric_limits<uint64_t>::max()) {
+                MonomialKey key;
+                key.valid = false;
+                return key;
+            }
+            return _encoder.encode(static_cast<uint64_t>(degree), m);
+        });
+    }
 };
 
 /**
- * @brief Uses dot prodcut with positive real vector and lex order specified by the `permutation` to
- * break ties.
- *
+ * @brief Layout of a `MonomialKey` as `numSlots` fields of equal width, slot `0` is the most
+ * significant. Reversed slots store the complement of their value.
  */
-class WeightedOrder : public MonomialOrder {
+class KeySlots {
+public:
+    explicit KeySlots(int numSlots)
+        : _width(numSlots > 0 ? std::min(32, 128 / numSlots) : 0),
+          _maxValue((uint64_t(1) << _width) - 1) {
+        _empty.valid = _width > 0;
+    }
+
+    void reverse(int slot) {
+        if (_width == 0) {
+            return;
+        }
+        _empty.flip(_maxValue, _shift(slot), _width);
+    }
+
+    //  Key with all slots `0`, invalid if the slots do not fit into 128 bits
+    const MonomialKey& empty() const {
+        return _empty;
+    }
+
+    void put(MonomialKey& key, int slot, uint64_t value) const {
+        if (value > _maxValue) {
+            key.valid = false;
+            return;
+        }
+        key.flip(value, _shift(slot), _width);
+    }
+
+private:
+    int _width;
+    uint64_t _maxValue;
+    MonomialKey _empty;
+
+    int _shift(int slot) const {
+        return 128 - (slot + 1) * _width;
+    }
+};
+
+/**
+ * @brief Matrix order: the rows of `matrix` are integral weight vectors over `permutation`,
+ * monomials are compared by the weighted degree of the first row where they differ and ties are
+ * broken by the lex order of `permutation`. The first non-zero entry of every column must be
+ * positive, so that `1` is the smallest monomial. Keys are packed for non-negative matrices.
+ */
+class MatrixOrder final : public MonomialOrder {
 
 public:
-    explicit WeightedOrder(std::vector<double> weights, std::vector<char> perm)
-        : _weights(std::move(weights)), _permutation(std::move(perm)) {
-        if (_weights.size() != _permutation.size()) {
-            throw std::invalid_argument("Weights and permutation must have the same size");
+    MatrixOrder(std::vector<std::vector<int64_t>> matrix, std::vector<char> perm)
+        : _matrix(std::move(matrix)), _permutation(std::move(perm)), _ranks(_permutation),
+          _slots(_matrix.size() + _permutation.size()) {
+
+        _nonNegative = true;
+        for (const std::vector<int64_t>& row : _matrix) {
+            if (row.size() != _permutation.size()) {
+                throw std::invalid_argument("Matrix rows and permutation must have the same size");
+            }
+            for (int64_t w : row) {
+                _nonNegative = _nonNegative && w >= 0;
+            }
         }
 
-        for (double w : _weights) {
-            if (w < 0.0) {
-                throw std::invalid_argument("Weights must be non-negative");
+        for (int column = 0; column < _permutation.size(); column++) {
+            for (const std::vector<int64_t>& row : _matrix) {
+                if (row[column] < 0) {
+                    throw std::invalid_argument("Matrix order is not a well-ordering");
+                }
+                if (row[column] > 0) {
+                    break;
+                }
             }
         }
     }
 
+    //  Same order as `LexOrder(perm)`
+    static MatrixOrder lex(const std::vector<char>& perm) {
+        std::vector<std::vector<int64_t>> matrix(perm.size(), std::vector<int64_t>(perm.size()));
+        for (int i = 0; i < perm.size(); i++) {
+            matrix[i][i] = 1;
+        }
+        return MatrixOrder(std::move(matrix), perm);
+    }
+
+    //  Same order as `GradedRevLexOrder(perm)`
+    static MatrixOrder gradedRevLex(const std::vector<char>& perm) {
+        std::vector<std::vector<int64_t>> matrix = {std::vector<int64_t>(perm.size(), 1)};
+        for (int i = 0; i + 1 < perm.size(); i++) {
+            matrix.push_back(std::vector<int64_t>(perm.size()));
+            matrix.back()[i] = -1;
+        }
+        return MatrixOrder(std::move(matrix), perm);
+    }
+
     bool compare(const Monomial& a, const Monomial& b) const override {
-        double dotProduct = 0.0;
+        if (_nonNegative) {
+            const MonomialKey& a_key = _key(a);
+            const MonomialKey& b_key = _key(b);
+            if (a_key.valid && b_key.valid) {
+                return a_key < b_key;
+            }
+        }
 
-        for (int i = 0; i < _weights.size(); i++) {
-            char var = _permutation[i];
-            int a_exp = a.getExponent(var);
-            int b_exp = b.getExponent(var);
-            dotProduct += _weights[i] * (a_exp - b_exp);
+        for (const std::vector<int64_t>& row : _matrix) {
+            const __int128 difference = weightedDifference(row, a, b);
+            if (difference != 0) {
+                return difference < 0;
+            }
         }
+        return _ranks.compareExponents(a, b) < 0;
+    }
+
+    /**
+     * @brief Exact `<weights, a - b>` for a weight vector over the permutation of this order, like
+     * the rows of the matrix
+     */
+    __int128 weightedDifference(const std::vector<int64_t>& weights, const Monomial& a,
+                                const Monomial& b) const {
+        __int128 difference = 0;
+        _ranks.forEachDifference(a, b, [&](int rank, int a_exp, int b_exp) {
+            difference += static_cast<__int128>(weights[rank]) * (a_exp - b_exp);
+        });
+        return difference;
+    }
+
+    const std::vector<std::vector<int64_t>>& matrix() const {
+        return _matrix;
+    }
+
+    const std::vector<char>& permutation() const {
+        return _permutation;
+    }
+
+private:
+    std::vector<std::vector<int64_t>> _matrix;
+    std::vector<char> _permutation;
+    VariableRanks _ranks;
+    KeySlots _slots;
+    bool _nonNegative;
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) {
+            MonomialKey key = _slots.empty();
+            for (int i = 0; key.valid && i < _matrix.size(); i++) {
+                unsigned __int128 weightedDegree = 0;
+                for (const auto& [var, exp] : m.getMonomial()) {
+                    const int rank = _ranks[var];
+                    if (rank >= 0) {
+                        weightedDegree += static_cast<unsigned __int128>(_matrix[i][rank]) * exp;
+                    }
+                }
+                if (weightedDegree > std::numeric_limits<uint64_t>::max()) {
+                    key.valid = false;
+                    break;
+                }
+                _slots.put(key, i, static_cast<uint64_t>(weightedDegree));
+            }
+            for (const auto& [var, exp] : m.getMonomial()) {
+                const int rank = _ranks[var];
+                if (rank >= 0) {
+                    _slots.put(key, _matrix.size() + rank, exp);
+                }
+            }
+            return key;
+        });
+    }
+};
+
+/**
+ * @brief Block (product) order: the variables of the first block outrank all others, within a
+ * block monomials compare like `GradedRevLexOrder` on the variables of that block. With blocks
+ * `{eliminated, kept}` it is an elimination order for `eliminated`, often much cheaper than lex.
+ */
+class BlockOrder final : public MonomialOrder {
 
-        if (std::abs(dotProduct) > std::numeric_limits<double>::epsilon()) {
-            return dotProduct < 0.0;
+public:
+    explicit BlockOrder(const std::vector<std::vector<char>>& blocks)
+        : _permutation(_concatenate(blocks)), _ranks(_permutation),
+          _slots(_permutation.size() + blocks.size()) {
+
+        for (int k = 0; k < blocks.size(); k++) {
+            if (blocks[k].empty()) {
+                throw std::invalid_argument("Blocks must not be empty");
+            }
+
+            //  Slots of block `k`: its degree followed by its complemented exponents
+            const int degreeSlot = _blockStart.size() + _block.size();
+            _blockStart.push_back(_block.size());
+            _degreeSlot.push_back(degreeSlot);
+            for (int i = 0; i < blocks[k].size(); i++) {
+                _block.push_back(k);
+                _slot.push_back(degreeSlot + 1 + i);
+                _slots.reverse(degreeSlot + 1 + i);
+            }
+        }
+
+        for (int rank = 0; rank < _permutation.size(); rank++) {
+            if (_ranks[_permutation[rank]] != rank) {
+                throw std::invalid_argument("Blocks must not share variables");
+            }
+        }
+    }
+
+    bool compare(const Monomial& a, const Monomial& b) const override {
+        const MonomialKey& a_key = _key(a);
+        const MonomialKey& b_key = _key(b);
+        if (a_key.valid && b_key.valid) {
+            return a_key < b_key;
         }
 
-        for (char var : _permutation) {
-            int a_exp = a.getExponent(var);
-            int b_exp = b.getExponent(var);
+        //  Per block the degree difference and the sign at the first differing variable
+        const int numBlocks = _blockStart.size();
+        std::vector<int64_t> degreeDifference(numBlocks, 0);
+        std::vector<int> firstRank(numBlocks, std::numeric_limits<int>::max());
+        std::vector<int> firstSign(numBlocks, 0);
+        _ranks.forEachDifference(a, b, [&](int rank, int a_exp, int b_exp) {
+            const int k = _block[rank];
+            degreeDifference[k] += a_exp - b_exp;
+            if (rank < firstRank[k]) {
+                firstRank[k] = rank;
+                firstSign[k] = a_exp < b_exp ? -1 : 1;
+            }
+        });
 
-            if (a_exp != b_exp) {
-                return a_exp < b_exp;
+        for (int k = 0; k < numBlocks; k++) {
+            if (degreeDifference[k] != 0) {
+                return degreeDifference[k] < 0;
+            }
+            if (firstSign[k] != 0) {
+                return firstSign[k] > 0;
             }
         }
         return false;
     }
 
 private:
-    std::vector<double> _weights;
     std::vector<char> _permutation;
+    VariableRanks _ranks;
+    KeySlots _slots;
+
+    //  Block, and key slot of every rank, first rank and degree slot of every block
+    std::vector<int> _block;
+    std::vector<int> _slot;
+    std::vector<int> _blockStart;
+    std::vector<int> _degreeSlot;
+
+    static std::vector<char> _concatenate(const std::vector<std::vector<char>>& blocks) {
+        std::vector<char> permutation;
+        for (const std::vector<char>& block : blocks) {
+            permutation.insert(permutation.end(), block.begin(), block.end());
+        }
+        return permutation;
+    }
+
+    const MonomialKey& _key(const Monomial& m) const {
+        return m.orderKey(id(), [this](const Monomial& m) {
+            MonomialKey key = _slots.empty();
+            for (int k = 0; key.valid && k < _blockStart.size(); k++) {
+                uint64_t degree = 0;
+                for (const auto& [var, exp] : m.getMonomial()) {
+                    const int rank = _ranks[var];
+                    degree += rank >= 0 && _block[rank] == k ? exp : 0;
+                }
+                _slots.put(key, _degreeSlot[k], degree);
+            }
+            for (const auto& [var, exp] : m.getMonomial()) {
+                const int rank = _ranks[var];
+                if (rank >= 0) {
+                    _slots.put(key, _slot[rank], exp);
+                }
+            }
+            return key;
+        });
+    }
 };
 
 #endif //  MONOMIAL_ORDERS_HPP
\ No newline at end of file
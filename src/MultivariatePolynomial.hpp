@@ -5,9 +5,11 @@
 #include "Monomial.hpp"
 #include "MonomialOrders.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <iostream>
 #include <map>
+#include <stdexcept>
 
 /**
  * @brief Represents a multivariable polynomial over a field `F`. Stores it as a map of monomials
@@ -37,8 +39,14 @@ public:
     MultivariatePolynomial(const MultivariatePolynomial<F>& other)
         : _coefficients(other._coefficients) { }
 
+    //  Moves keep the leading term cache, so a growing basis does not recompute it
     MultivariatePolynomial(MultivariatePolynomial<F>&& other) noexcept
-        : _coefficients(std::move(other._coefficients)) { }
+        : _coefficients(std::move(other._coefficients)),
+          _cachedLeadingMonomial(std::move(other._cachedLeadingMonomial)),
+          _cachedLeadingCoefficient(std::move(other._cachedLeadingCoefficient)),
+          _cachedOrderId(other._cachedOrderId), _validLeadingTerm(other._validLeadingTerm) {
+        other._validLeadingTerm = false;
+    }
 
     explicit MultivariatePolynomial(const std::string& str) {
         std::string s = str;
@@ -178,7 +186,8 @@ public:
         }
     }
 
-    std::map<Monomial, F> getCoefficients() const {
+    //  Terms of the polynomial, a view valid as long as the polynomial is not modified
+    const std::map<Monomial, F>& getCoefficients() const {
         return _coefficients;
     }
 
@@ -189,7 +198,7 @@ public:
                 _validLeadingTerm = true;
                 _cachedLeadingMonomial = other._cachedLeadingMonomial;
                 _cachedLeadingCoefficient = other._cachedLeadingCoefficient;
-                _cachedOrder = other._cachedOrder;
+                _cachedOrderId = other._cachedOrderId;
             }
             else {
                 _validLeadingTerm = false;
@@ -198,6 +207,20 @@ public:
         return *this;
     }
 
+    MultivariatePolynomial<F>& operator=(MultivariatePolynomial<F>&& other) noexcept {
+        if (this != &other) {
+            _coefficients = std::move(other._coefficients);
+            _validLeadingTerm = other._validLeadingTerm;
+            if (other._validLeadingTerm) {
+                _cachedLeadingMonomial = std::move(other._cachedLeadingMonomial);
+                _cachedLeadingCoefficient = std::move(other._cachedLeadingCoefficient);
+                _cachedOrderId = other._cachedOrderId;
+                other._validLeadingTerm = false;
+            }
+        }
+        return *this;
+    }
+
     MultivariatePolynomial operator+(const MultivariatePolynomial<F>& other) const {
         std::map<Monomial, F> result = _coefficients;
 
@@ -315,6 +338,50 @@ public:
         return *this;
     }
 
+    //  `p += c·m` in place
+    MultivariatePolynomial& addTerm(const F& coefficient, const Monomial& monomial) {
+        if (coefficient != F::zero) {
+            auto [it, inserted] = _coefficients.try_emplace(monomial, coefficient);
+
+            if (!inserted) {
+                it->second += coefficient;
+                if (it->second == F::zero) {
+                    _coefficients.erase(it);
+                }
+            }
+        }
+
+        _validLeadingTerm = false;
+        return *this;
+    }
+
+    /**
+     * @brief `p += c·m·g` in place, without materializing the product. This is the elimination
+     * step of polynomial division and of S-polynomials.
+     */
+    MultivariatePolynomial& addMulTerm(const F& coefficient, const Monomial& monomial,
+                                       const MultivariatePolynomial<F>& g) {
+        if (&g == this) {
+            return addMulTerm(coefficient, monomial, MultivariatePolynomial<F>(g));
+        }
+        if (coefficient != F::zero) {
+            for (const auto& [g_monomial, g_coefficient] : g._coefficients) {
+                F product = coefficient * g_coefficient;
+                auto [it, inserted] = _coefficients.try_emplace(monomial * g_monomial, product);
+
+                if (!inserted) {
+                    it->second += product;
+                    if (it->second == F::zero) {
+                        _coefficients.erase(it);
+                    }
+                }
+            }
+        }
+
+        _validLeadingTerm = false;
+        return *this;
+    }
+
     MultivariatePolynomial operator*(const MultivariatePolynomial<F>& other) const {
         if (isZeroPolynomial() || other.isZeroPolynomial()) {
             return MultivariatePolynomial();
@@ -555,6 +622,19 @@ public:
         return result;
     }
 
+    int termCount() const {
+        return _coefficients.size();
+    }
+
+    //  Largest `bitLength` among the coefficients, measures coefficient growth
+    int maxCoefficientBits() const {
+        int result = 0;
+        for (const auto& [_, coefficient] : _coefficients) {
+            result = std::max(result, coefficient.bitLength());
+        }
+        return result;
+    }
+
     std::vector<char> getVariables() const {
         std::set<char> variables;
         for (const auto& [monomial, _] : _coefficients) {
@@ -592,12 +672,52 @@ public:
         return MultivariatePolynomial(std::move(result));
     }
 
-    const Monomial& leadingMonomial(const MonomialOrder& order) const {
+    //  Whether all terms share the same total degree, the zero polynomial counts as homogeneous
+    bool isHomogeneous() const {
+        const int degree = _coefficients.empty() ? 0 : _coefficients.begin()->first.getDegree();
+        return std::all_of(_coefficients.begin(), _coefficients.end(),
+                           [degree](const auto& term) { return term.first.getDegree() == degree; });
+    }
+
+    /**
+     * @brief Multiplies every term with the power of `var` that lifts it to the total degree of the
+     * polynomial. `var` must not occur in the polynomial yet.
+     */
+    MultivariatePolynomial homogenize(char var) const {
+        for (const auto& [monomial, _] : _coefficients) {
+            if (monomial.getExponent(var) > 0) {
+                throw std::invalid_argument(std::string("Homogenizing variable '") + var +
+                                            "' already occurs in the polynomial");
+            }
+        }
+
+        const int degree = totalDegree();
+        std::map<Monomial, F> result;
+        for (const auto& [monomial, coefficient] : _coefficients) {
+            std::map<char, int> lifted = monomial.getMonomial();
+            if (monomial.getDegree() < degree) {
+                lifted[var] = degree - monomial.getDegree();
+            }
+            result.emplace(Monomial(std::move(lifted)), coefficient);
+        }
+        return MultivariatePolynomial(std::move(result));
+    }
+
+    //  Inverse of `homogenize`, sets `var` to one
+    MultivariatePolynomial dehomogenize(char var) const {
+        return substitute(var, F::one);
+    }
+
+    /**
+     * @brief Largest monomial with respect to `order`. `Order` is the concrete order type where
+     * known, so the comparisons are dispatched statically.
+     */
+    template<typename Order> const Monomial& leadingMonomial(const Order& order) const {
         _cacheLeadingMonomialAndCoefficient(order);
         return _cachedLeadingMonomial;
     }
 
-    F leadingCoefficient(const MonomialOrder& order) const {
+    template<typename Order> F leadingCoefficient(const Order& order) const {
         _cacheLeadingMonomialAndCoefficient(order);
         return _cachedLeadingCoefficient;
     }
@@ -606,7 +726,8 @@ private:
     std::map<Monomial, F> _coefficients;
     mutable Monomial _cachedLeadingMonomial;
     mutable F _cachedLeadingCoefficient;
-    mutable const MonomialOrder* _cachedOrder = nullptr;
+    //  `MonomialOrder::id` of the order the cache belongs to
+    mutable uint64_t _cachedOrderId = 0;
     mutable bool _validLeadingTerm = false;
 
     F _power(F base, int exp) const {
@@ -621,9 +742,9 @@ private:
         return result;
     }
 
-    void _cacheLeadingMonomialAndCoefficient(const MonomialOrder& order) const {
+    template<typename Order> void _cacheLeadingMonomialAndCoefficient(const Order& order) const {
         //  Only recompute if the order has changed or cache is invalid
-        if (_cachedOrder != &order || !_validLeadingTerm) {
+        if (_cachedOrderId != order.id() || !_validLeadingTerm) {
             auto maxIt = std::max_element(
                 _coefficients.begin(), _coefficients.end(),
                 [&order](const auto& a, const auto& b) { return order.compare(a.first, b.first); });
@@ -637,7 +758,7 @@ private:
                 _cachedLeadingCoefficient = maxIt->second;
             }
 
-            _cachedOrder = &order;
+            _cachedOrderId = order.id();
             _validLeadingTerm = true;
         }
     }
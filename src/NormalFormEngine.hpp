@@ -0,0 +1,64 @@
+#ifndef NORMAL_FORM_ENGINE_HPP
+#define NORMAL_FORM_ENGINE_HPP
+
+#include "GroebnerBasis.hpp"
+#include "MultivariatePolynomial.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+
+/**
+ * @brief Normal forms modulo a fixed Groebner basis `G`. The leading terms of `G` are indexed
+ * once, every division afterwards only tracks the remainder. With a Groebner basis the normal
+ * form does not depend on the order of `G` and is zero exactly for the members of the ideal.
+ */
+template<typename F, typename Order> class NormalFormEngine {
+public:
+    NormalFormEngine(std::vector<MultivariatePolynomial<F>> G, Order order)
+        : _basis(std::move(G)), _order(std::move(order)), _index(_basis, _order) { }
+
+    MultivariatePolynomial<F> normalForm(const MultivariatePolynomial<F>& f,
+                                         ReductionCounters* counters = nullptr) const {
+        return ::normalForm(f, _basis, _index, _order, counters);
+    }
+
+    /**
+     * @brief Normal forms of all of `fs` in their order. The divisions only read the basis and
+     * the index, whose leading terms and order keys were filled when the index was built, so they
+     * are spread over `pool` when given.
+     */
+    std::vector<MultivariatePolynomial<F>>
+        normalForms(const std::vector<MultivariatePolynomial<F>>& fs,
+                    ThreadPool* pool = nullptr) const {
+        std::vector<MultivariatePolynomial<F>> result(fs.size());
+        if (pool == nullptr) {
+            for (int k = 0; k < fs.size(); k++) {
+                result[k] = normalForm(fs[k]);
+            }
+        }
+        else {
+            pool->parallelFor(fs.size(), [&](int k) { result[k] = normalForm(fs[k]); });
+        }
+        return result;
+    }
+
+    //  Ideal membership
+    bool contains(const MultivariatePolynomial<F>& f) const {
+        return normalForm(f).isZeroPolynomial();
+    }
+
+    const std::vector<MultivariatePolynomial<F>>& basis() const {
+        return _basis;
+    }
+
+    const Order& order() const {
+        return _order;
+    }
+
+private:
+    std::vector<MultivariatePolynomial<F>> _basis;
+    Order _order;
+    LeadingTermIndex<F> _index;
+};
+
+#endif //  NORMAL_FORM_ENGINE_HPP
@@ -0,0 +1,86 @@
+#ifndef PROGRESS_REPORTER_HPP
+#define PROGRESS_REPORTER_HPP
+
+#include "Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief Rate limited progress of a long running phase. `advance` only bumps an atomic counter
+ * and reads the clock, at most one report per `interval` reaches the callback. Threads never wait
+ * for each other: whoever first notices that the interval elapsed delivers the report. Reports
+ * from `advance` therefore run on the calling pool threads, possibly several at once and with
+ * `current` out of order, so the callback must be thread-safe.
+ */
+class ProgressReporter {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void(int64_t current, int64_t total)>;
+
+    explicit ProgressReporter(Callback callback,
+                              Clock::duration interval = std::chrono::milliseconds(100))
+        : _callback(std::move(callback)), _interval(interval.count()) { }
+
+    //  Starts a phase of `total` steps, the first report comes after one interval
+    void start(int64_t total) {
+        _total = total;
+        _current.store(0, std::memory_order_relaxed);
+        _nextReport.store(_now() + _interval, std::memory_order_relaxed);
+    }
+
+    void advance(int64_t steps = 1) {
+        const int64_t current = _current.fetch_add(steps, std::memory_order_relaxed) + steps;
+
+        const int64_t now = _now();
+        int64_t nextReport = _nextReport.load(std::memory_order_relaxed);
+        if (now < nextReport ||
+            !_nextReport.compare_exchange_strong(nextReport, now + _interval,
+                                                 std::memory_order_relaxed)) {
+            return;
+        }
+        _report(current);
+    }
+
+    //  Reports the end of the phase unconditionally, call once all steps are done
+    void finish() {
+        _report(_total);
+    }
+
+    /**
+     * @brief Reporter drawing `Logger::printProgressBar` on the console, the bar is cleared when
+     * the phase finishes. `Logger` serializes the output, so concurrent reports at worst draw an
+     * older bar over a newer one.
+     */
+    static ProgressReporter console() {
+        return ProgressReporter([](int64_t current, int64_t total) {
+            if (current >= total) {
+                Logger::clearProgressBar();
+            }
+            else {
+                Logger::printProgressBar(current, total);
+            }
+        });
+    }
+
+private:
+    Callback _callback;
+    Clock::rep _interval;
+    int64_t _total = 0;
+    std::atomic<int64_t> _current{0};
+    std::atomic<Clock::rep> _nextReport{0};
+
+    static Clock::rep _now() {
+        return Clock::now().time_since_epoch().count();
+    }
+
+    void _report(int64_t current) {
+        if (_callback) {
+            _callback(current, _total);
+        }
+    }
+};
+
+#endif //  PROGRESS_REPORTER_HPP
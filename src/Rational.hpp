@@ -436,6 +436,20 @@ public:
         return _denominator == 1;
     }
 
+    //  Bits of numerator and denominator together, a measure of coefficient growth
+    int bitLength() const {
+        auto bits = [](uint64_t value) {
+            int result = 0;
+            for (; value != 0; value >>= 1) {
+                result++;
+            }
+            return result;
+        };
+        const uint64_t numerator = _numerator < 0 ? -static_cast<uint64_t>(_numerator)
+                                                  : static_cast<uint64_t>(_numerator);
+        return bits(numerator) + bits(static_cast<uint64_t>(_denominator));
+    }
+
     const static Rational zero;
     const static Rational one;
 
@@ -140,10 +140,15 @@ public:
         return Real(std::pow(_value, static_cast<double>(exp)));
     }
 
-    double getValue() {
+    double getValue() const {
         return _value;
     }
 
+    //  Fixed precision, coefficients cannot grow
+    int bitLength() const {
+        return 64;
+    }
+
     static void setEpsilon(double eps) {
         epsilon = eps;
     }
@@ -158,4 +163,6 @@ private:
 };
 
 
+template<> inline constexpr bool isExactField<Real> = false;
+
 #endif //  REAL_HPP
@@ -1,258 +1,703 @@
 #include "Logger.hpp"
 #include "Solver.hpp"
 
-std::vector<int64_t> divisors(int64_t n) {
-    n = std::abs(n);
-    std::vector<int64_t> result;
+//  Lift to arbitrary precision so that Hensel lifting cannot overflow `int64_t`
+UnivariatePolynomial<BigRational> toBigRational(const UnivariatePolynomial<Rational>& f) {
+    std::vector<BigRational> coefficients;
+    for (const Rational& coefficient : f.getCoefficients()) {
+        coefficients.push_back(
+            BigRational(coefficient.getNumerator(), coefficient.getDenominator()));
+    }
+    return UnivariatePolynomial<BigRational>(std::move(coefficients));
+}
 
-    if (n == 0) {
-        return result;
+std::vector<Rational> toRational(const std::vector<BigRational>& bigRoots) {
+    std::vector<Rational> roots;
+    for (const BigRational& r : bigRoots) {
+        roots.push_back(Rational(r.getNumerator().convert_to<int64_t>(),
+                                 r.getDenominator().convert_to<int64_t>()));
     }
-    for (int64_t i = 1; i * i <= n; i++) {
-        if (n % i == 0) {
-            result.push_back(i);
-            if (i != n / i) {
-                result.push_back(n / i);
+    return roots;
+}
+
+std::vector<Rational> findRationalRoots(const UnivariatePolynomial<Rational>& f) {
+    return toRational(findBigRationalRoots(toBigRational(f)));
+}
+
+std::vector<Rational> findRationalRootsSquareFree(const UnivariatePolynomial<Rational>& f) {
+    return toRational(findBigRationalRootsSquareFree(toBigRational(f)));
+}
+
+std::vector<GaloisField> findGaloisFieldRoots(const UnivariatePolynomial<GaloisField>& f) {
+    if (f.degree() <= 0) {
+        return {};
+    }
+
+    //  Distinct roots only, so the search can stop after `deg g` of them
+    return findGaloisFieldRootsSquareFree(squareFreePart(f));
+}
+
+std::vector<GaloisField>
+    findGaloisFieldRootsSquareFree(const UnivariatePolynomial<GaloisField>& g) {
+    std::vector<GaloisField> roots;
+    if (g.degree() <= 0) {
+        return roots;
+    }
+
+    //  Candidates are tested in blocks so that memory stays bounded for large primes
+    const int64_t blockSize = 4'096;
+    std::vector<GaloisField> candidates;
+    candidates.reserve(std::min(blockSize, GaloisField::prime));
+
+    for (int64_t start = 0; start < GaloisField::prime; start += blockSize) {
+        candidates.clear();
+        for (int64_t i = start; i < std::min(start + blockSize, GaloisField::prime); i++) {
+            candidates.push_back(GaloisField(i));
+        }
+
+        std::vector<GaloisField> values = g.evaluateMany(candidates);
+        for (int i = 0; i < candidates.size(); i++) {
+            if (values[i] == GaloisField::zero) {
+                roots.push_back(candidates[i]);
             }
         }
+
+        if (roots.size() >= g.degree()) {
+            break;
+        }
+    }
+    return roots;
+}
+
+double evaluateDouble(const std::vector<double>& f, double x) {
+    double result = 0.0;
+    for (int i = static_cast<int>(f.size()) - 1; i >= 0; i--) {
+        result = result * x + f[i];
     }
     return result;
-};
+}
 
-std::vector<Rational> findRationalRoots(const UnivariatePolynomial<Rational>& f) {
-    if (f.degree() == 0) {
-        return {};
+//  Number of sign changes in the coefficient sequence, zeros are skipped
+int signVariations(const std::vector<BigInt>& f) {
+    int variations = 0;
+    int lastSign = 0;
+    for (const BigInt& c : f) {
+        int sign = c.sign();
+        if (sign != 0) {
+            if (lastSign != 0 && sign != lastSign) {
+                variations++;
+            }
+            lastSign = sign;
+        }
     }
+    return variations;
+}
 
-    std::vector<int64_t> denominators;
-    for (const Rational& coefficient : f.getCoefficients()) {
-        denominators.push_back(coefficient.getDenominator());
+//  `f(x) → f(x + c)` in place using the classical O(n²) Taylor shift
+void taylorShift(std::vector<BigInt>& f, const BigInt& c) {
+    const int n = f.size();
+    for (int i = 0; i < n - 1; i++) {
+        for (int j = n - 2; j >= i; j--) {
+            f[j] += c * f[j + 1];
+        }
     }
+}
 
-    int64_t lcm_val = denominators.front();
-    for (int i = 1; i < denominators.size(); i++) {
-        lcm_val = std::lcm(lcm_val, denominators[i]);
+//  Divides all coefficients by their largest common power of two
+void removeCommonPowerOfTwo(std::vector<BigInt>& f) {
+    unsigned shift = std::numeric_limits<unsigned>::max();
+    for (const BigInt& c : f) {
+        if (c != 0) {
+            shift = std::min(shift, boost::multiprecision::lsb(boost::multiprecision::abs(c)));
+        }
     }
+    if (shift != std::numeric_limits<unsigned>::max() && shift > 0) {
+        for (BigInt& c : f) {
+            c >>= shift;
+        }
+    }
+}
 
-    UnivariatePolynomial<Rational> g = f * Rational(lcm_val);
-    std::vector<Rational> coefficients = g.getCoefficients();
+/**
+ * Upper bound for the number of roots of `q` in `(0; 1)` given by Descartes' rule of signs
+ * applied to `(x + 1)ⁿ q(1 / (x + 1))`. The bound is exact when it equals 0 or 1.
+ */
+int descartesBound(const std::vector<BigInt>& q) {
+    std::vector<BigInt> r(q.rbegin(), q.rend());
+    taylorShift(r, 1);
+    return signVariations(r);
+}
 
-    auto it = std::find_if(coefficients.begin(), coefficients.end(),
-                           [](const Rational& r) { return r != Rational::zero; });
-    Rational constantTerm = *it;
-    Rational leadingTerm = coefficients.back();
+/**
+ * @brief Safeguarded Newton iteration on a bracket `[a; b]` where `f(a)` and `f(b)` have
+ * opposite signs. Falls back to bisection whenever a Newton step leaves the bracket, so it
+ * converges quadratically near the root while never losing it.
+ */
+double bracketedNewton(const std::vector<double>& f, const std::vector<double>& df, double a,
+                       double b) {
+    double fa = evaluateDouble(f, a);
+    double x = (a + b) / 2;
+
+    for (int i = 0; i < 200; i++) {
+        double fx = evaluateDouble(f, x);
+        if (fx == 0.0) {
+            return x;
+        }
 
-    std::vector<int64_t> P = divisors(constantTerm.getNumerator());
-    std::vector<int64_t> Q = divisors(leadingTerm.getNumerator());
+        if ((fx < 0.0) == (fa < 0.0)) {
+            a = x;
+            fa = fx;
+        }
+        else {
+            b = x;
+        }
 
-    std::set<Rational> candidates;
-    candidates.insert(Rational::zero);
+        double dfx = evaluateDouble(df, x);
+        double next = dfx != 0.0 ? x - fx / dfx : a;
+        if (!(next > a && next < b)) {
+            next = (a + b) / 2;
+        }
 
-    for (int64_t p : P) {
-        for (int64_t q : Q) {
-            candidates.insert(Rational(p, q));
-            candidates.insert(Rational(-p, q));
+        if (next == x || b - a <= std::numeric_limits<double>::epsilon() * std::abs(x)) {
+            return next;
         }
+        x = next;
     }
+    return x;
+}
 
-    std::vector<Rational> roots;
-    int degree = g.degree();
-    int counter = 0;
+/**
+ * @brief Real root isolation by Descartes' rule of signs with Vincent–Collins–Akritas bisection.
+ * Every double is a dyadic rational, so `f` is scaled to an integer polynomial and each interval
+ * `(a; b)` is represented exactly by `q(x) = f(a + (b - a)x)`. Halving an interval only needs a
+ * rescaling by powers of two and one Taylor shift, which keeps the sign counts exact. Intervals
+ * with one sign variation and a sign change of `f` are refined with bracketed Newton. Intervals
+ * that shrink to double precision without being resolved hold a cluster of roots and report its
+ * midpoint. The cost depends on the degree and root separation, not on the Cauchy bound.
+ */
+std::vector<Real> findRealRoots(const UnivariatePolynomial<Real>& f) {
+    if (f.degree() <= 0) {
+        return {};
+    }
 
-    for (const Rational& r : candidates) {
-        if (g.evaluate(r) == Rational::zero) {
-            roots.push_back(r);
-            counter++;
-        }
+    std::vector<double> coefficients;
+    for (const Real& c : f.getCoefficients()) {
+        coefficients.push_back(c.getValue());
+    }
+    const int n = f.degree();
+
+    std::vector<double> df;
+    for (int i = 1; i <= n; i++) {
+        df.push_back(coefficients[i] * i);
+    }
 
-        if (counter == degree) {
-            return roots;
+    //  Cauchy bound rounded up to a power of two, all roots lie in `(-B; B)`
+    double cauchyBound = 0.0;
+    for (int i = 0; i < n; i++) {
+        cauchyBound = std::max(cauchyBound, std::abs(coefficients[i] / coefficients[n]));
+    }
+    int boundExponent;
+    std::frexp(cauchyBound + 1.0, &boundExponent);
+    const double bound = std::ldexp(1.0, boundExponent);
+
+    //  Exact integer image of `f`: each coefficient is `m · 2^e` with a 53 bit mantissa `m`
+    int minExponent = std::numeric_limits<int>::max();
+    for (double c : coefficients) {
+        if (c != 0.0) {
+            int e;
+            std::frexp(c, &e);
+            minExponent = std::min(minExponent, e - 53);
         }
     }
 
-    return roots;
-}
+    std::vector<BigInt> q;
+    for (double c : coefficients) {
+        int e;
+        double m = std::frexp(c, &e);
+        BigInt integer = static_cast<int64_t>(std::ldexp(m, 53));
+        q.push_back(c == 0.0 ? BigInt(0) : BigInt(integer << (e - 53 - minExponent)));
+    }
 
-std::vector<GaloisField> findGaloisFieldRoots(const UnivariatePolynomial<GaloisField>& f) {
-    std::vector<GaloisField> roots;
-    int degree = f.degree();
-    int counter = 0;
+    //  `q(x) = f(-B + 2Bx)`
+    taylorShift(q, -(BigInt(1) << boundExponent));
+    for (int i = 0; i <= n; i++) {
+        q[i] <<= (boundExponent + 1) * i;
+    }
+    removeCommonPowerOfTwo(q);
 
-    for (int64_t i = 0; i < GaloisField::prime; i++) {
-        GaloisField candidate(i);
+    struct Interval {
+        double a;
+        double b;
+        std::vector<BigInt> q;
+    };
 
-        if (f.evaluate(candidate) == GaloisField::zero) {
-            roots.push_back(candidate);
-            counter++;
+    std::vector<double> rawRoots;
+    std::vector<Interval> stack;
+    stack.push_back({-bound, bound, std::move(q)});
+
+    while (!stack.empty()) {
+        Interval interval = std::move(stack.back());
+        stack.pop_back();
+
+        int variations = descartesBound(interval.q);
+        if (variations == 0) {
+            continue;
+        }
+
+        double mid = (interval.a + interval.b) / 2;
+        if (variations == 1) {
+            double fa = evaluateDouble(coefficients, interval.a);
+            double fb = evaluateDouble(coefficients, interval.b);
+            if (fa != 0.0 && fb != 0.0 && (fa < 0.0) != (fb < 0.0)) {
+                rawRoots.push_back(bracketedNewton(coefficients, df, interval.a, interval.b));
+                continue;
+            }
+        }
+
+        if (interval.b - interval.a <=
+            4 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(mid))) {
+            rawRoots.push_back(mid);
+            continue;
+        }
+
+        //  Left half `2ⁿ q(x / 2)`, right half is its shift by one
+        std::vector<BigInt> left = std::move(interval.q);
+        for (int i = 0; i <= n; i++) {
+            left[i] <<= n - i;
         }
+        std::vector<BigInt> right = left;
+        taylorShift(right, 1);
+        removeCommonPowerOfTwo(left);
+        removeCommonPowerOfTwo(right);
+
+        //  Roots at the split point are not counted by either half
+        if (right.front() == 0) {
+            rawRoots.push_back(mid);
+        }
+
+        stack.push_back({mid, interval.b, std::move(right)});
+        stack.push_back({interval.a, mid, std::move(left)});
+    }
 
-        if (counter == degree) {
-            return roots;
+    //  Merge roots that were reported by neighbouring intervals
+    std::sort(rawRoots.begin(), rawRoots.end());
+    std::vector<Real> roots;
+    for (double root : rawRoots) {
+        if (roots.empty() || std::abs(root - roots.back().getValue()) > Real::epsilon * 100) {
+            roots.push_back(Real(root));
         }
     }
+
     return roots;
 }
 
-std::pair<Real, bool> newton(const UnivariatePolynomial<Real>& f,
-                             const UnivariatePolynomial<Real>& df, Real x0) {
-    Real x = x0;
-    const int maxIt = 1'000'000;
+/**
+ * @brief Aberth–Ehrlich simultaneous iteration for all complex roots of `f`. Starting points are
+ * spread on a circle whose radius matches the size of the roots, then every approximation is
+ * corrected by `w_k = 1 / (p'(z_k) / p(z_k) - Σ_{j≠k} 1 / (z_k - z_j))`. Corrections of one sweep
+ * are computed from the previous approximations only (Jacobi style) so the sweep is a plain loop
+ * over independent roots. Convergence is cubic for simple roots and an approximation is frozen once
+ * its value drops below the rounding error bound of Horner's scheme. Throws `std::runtime_error` if
+ * some approximation is still not frozen after the last iteration.
+ */
+std::vector<std::complex<double>> aberthEhrlich(const std::vector<std::complex<double>>& f) {
+    const int n = f.size() - 1;
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    std::vector<std::complex<double>> df(n);
+    std::vector<double> absF(n + 1);
+    for (int i = 0; i <= n; i++) {
+        absF[i] = std::abs(f[i]);
+        if (i > 0) {
+            df[i - 1] = f[i] * static_cast<double>(i);
+        }
+    }
+
+    //  Half of Fujiwara's bound, `max |a_(n-k) / a_n|^(1/k)`
+    double radius = 0.0;
+    for (int k = 1; k <= n; k++) {
+        radius = std::max(radius, std::pow(absF[n - k] / absF[n], 1.0 / k));
+    }
+    if (radius == 0.0) {
+        radius = 1.0;
+    }
+
+    const double pi = std::acos(-1.0);
+    std::vector<std::complex<double>> z(n);
+    for (int k = 0; k < n; k++) {
+        z[k] = std::polar(radius, 2 * pi * k / n + 0.4);
+    }
+
+    const int maxIterations = 500;
+    std::vector<bool> converged(n, false);
+    std::vector<std::complex<double>> w(n);
+    bool allConverged = false;
+
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        allConverged = true;
+
+        for (int k = 0; k < n; k++) {
+            w[k] = 0.0;
+            if (converged[k]) {
+                continue;
+            }
+
+            std::complex<double> p = f[n];
+            std::complex<double> dp = 0.0;
+            double errorBound = absF[n];
+            const double absZ = std::abs(z[k]);
+            for (int i = n - 1; i >= 0; i--) {
+                dp = dp * z[k] + p;
+                p = p * z[k] + f[i];
+                errorBound = errorBound * absZ + absF[i];
+            }
+
+            if (std::abs(p) <= 4 * n * eps * errorBound) {
+                converged[k] = true;
+                continue;
+            }
 
-    for (int i = 0; i < maxIt; i++) {
-        Real value = f.evaluate(x);
-        Real dvalue = df.evaluate(x);
+            std::complex<double> sum = 0.0;
+            for (int j = 0; j < n; j++) {
+                if (j != k) {
+                    sum += 1.0 / (z[k] - z[j]);
+                }
+            }
 
-        if (value == Real::zero) {
-            return {x, true};
+            w[k] = 1.0 / (dp / p - sum);
+            allConverged = false;
         }
 
-        if (dvalue == Real::zero) {
-            //  Try a small perturbation
-            x += Real(Real::epsilon * 1'000);
-            continue;
+        if (allConverged) {
+            break;
         }
 
-        Real xNew = x - value / dvalue;
-        if (x == xNew) {
-            return {x, true};
+        for (int k = 0; k < n; k++) {
+            z[k] -= w[k];
         }
-        x = xNew;
     }
 
-    return {x, false};
+    //  Unfrozen approximations may be far from any root, returning them would report wrong roots
+    if (!allConverged) {
+        throw std::runtime_error("Aberth–Ehrlich iteration did not converge within " +
+                                 std::to_string(maxIterations) + " iterations");
+    }
+
+    return z;
 }
 
-std::vector<Real> findRealRoots(const UnivariatePolynomial<Real>& f) {
+/**
+ * @brief Finds all complex roots of `f` at once with the Aberth–Ehrlich method. Roots closer than
+ * `100 · Complex::epsilon` are reported once. The result is sorted by real and then imaginary part.
+ * Throws `std::runtime_error` if the iteration does not converge.
+ */
+std::vector<Complex> findComplexRoots(const UnivariatePolynomial<Complex>& f) {
+    if (f.degree() <= 0) {
+        return {};
+    }
 
-    //  Calculate Cauchy Bound
-    std::vector<Real> coefficients = f.getCoefficients();
-    Real leadingCoeff = coefficients.back();
-    double cauchyBound = -1.0;
-    for (Real coeff : coefficients) {
-        cauchyBound = std::max(cauchyBound, std::abs(coeff.getValue() / leadingCoeff.getValue()));
+    std::vector<std::complex<double>> coefficients;
+    for (const Complex& c : f.getCoefficients()) {
+        coefficients.push_back(c.getValue());
     }
 
-    //  Find initial guesses in the range
-    int cauchyBoundInt = 1 + std::ceil(cauchyBound);
-    std::vector<Real> initialGuesses;
-    for (int i = -cauchyBoundInt; i <= cauchyBoundInt; i++) {
-        initialGuesses.push_back(Real(i));
+    std::vector<Complex> rawRoots;
+    for (const std::complex<double>& z : aberthEhrlich(coefficients)) {
+        rawRoots.push_back(Complex(z));
     }
+    std::sort(rawRoots.begin(), rawRoots.end());
 
-    //  Apply Newton's method to each initial guess
-    std::set<Real> potentialRoots;
-    UnivariatePolynomial<Real> df = f.derivative();
-    for (const Real& guess : initialGuesses) {
-        auto [root, succes] = newton(f, df, guess);
-        if (succes) {
-            potentialRoots.insert(root);
+    std::vector<Complex> roots;
+    for (const Complex& root : rawRoots) {
+        bool isNew = std::none_of(roots.begin(), roots.end(), [&root](const Complex& r) {
+            return std::abs(r.getValue() - root.getValue()) <= Complex::epsilon * 100;
+        });
+        if (isNew) {
+            roots.push_back(root);
         }
     }
 
-    //  Cluster roots if there are more than they should
-    std::vector<Real> rawRoots(potentialRoots.begin(), potentialRoots.end());
-    std::sort(rawRoots.begin(), rawRoots.end());
+    return roots;
+}
 
-    std::vector<Real> clusteredRoots;
-    Real currentCluster = rawRoots.front();
+/**
+ * @brief Real roots of `f` obtained by filtering the Aberth–Ehrlich approximations of all its
+ * complex roots. Unlike `findRealRoots` the number of iterations does not depend on where the roots
+ * are, only on the degree. Throws `std::runtime_error` if the iteration does not converge.
+ */
+std::vector<Real> findRealRootsAberth(const UnivariatePolynomial<Real>& f) {
+    if (f.degree() <= 0) {
+        return {};
+    }
 
-    for (int i = 1; i < rawRoots.size(); i++) {
-        if (std::abs(rawRoots[i].getValue() - currentCluster.getValue()) <= Real::epsilon * 100) {
-            currentCluster = (currentCluster + rawRoots[i]) / Real(2.0);
+    std::vector<std::complex<double>> coefficients;
+    for (const Real& c : f.getCoefficients()) {
+        coefficients.push_back(c.getValue());
+    }
+
+    std::vector<double> rawRoots;
+    for (const std::complex<double>& z : aberthEhrlich(coefficients)) {
+        if (std::abs(z.imag()) <= Real::epsilon * 100 * std::max(1.0, std::abs(z))) {
+            rawRoots.push_back(z.real());
         }
-        else {
-            clusteredRoots.push_back(currentCluster);
-            currentCluster = rawRoots[i];
+    }
+    std::sort(rawRoots.begin(), rawRoots.end());
+
+    std::vector<Real> roots;
+    for (double root : rawRoots) {
+        if (roots.empty() || std::abs(root - roots.back().getValue()) > Real::epsilon * 100) {
+            roots.push_back(Real(root));
         }
     }
-    clusteredRoots.push_back(currentCluster);
 
+    return roots;
+}
 
-    return clusteredRoots;
+BigInt lcm(const BigInt& a, const BigInt& b) {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+    return boost::multiprecision::abs(a * b) / boost::multiprecision::gcd(a, b);
 }
 
-using BigInt = boost::multiprecision::cpp_int;
 
-std::vector<BigInt> divisors(const BigInt& n) {
-    BigInt m = boost::multiprecision::abs(n);
-    std::vector<BigInt> result;
+bool isSmallPrime(int64_t n) {
+    if (n < 2) {
+        return false;
+    }
+    for (int64_t i = 2; i * i <= n; i++) {
+        if (n % i == 0) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    if (m == 0 || m == 1) {
-        if (m == 1) {
-            result.push_back(1);
+//  Representative of `a mod p` in the range `[0; p-1]`
+int64_t reduceModPrime(const BigInt& a, int64_t p) {
+    int64_t r = static_cast<int64_t>(a % p);
+    return r < 0 ? r + p : r;
+}
+
+int64_t inverseModPrime(int64_t a, int64_t p) {
+    int64_t result = 1;
+    int64_t exp = p - 2;
+    a %= p;
+    while (exp > 0) {
+        if (exp & 1) {
+            result = (result * a) % p;
         }
-        return result;
+        a = (a * a) % p;
+        exp >>= 1;
     }
+    return result;
+}
 
-    for (BigInt i = 1; i * i <= m; ++i) {
-        if (m % i == 0) {
-            result.push_back(i);
-            
-            BigInt j = m / i;
-            if (i != j) {
-                result.push_back(j);
+/**
+ * Polynomials over `F_p` are kept as plain coefficient vectors in ascending order of powers so that
+ * the search for a good prime never touches the global `GaloisField::prime`.
+ */
+std::vector<int64_t> reducePolynomialModPrime(const std::vector<BigInt>& f, int64_t p) {
+    std::vector<int64_t> result;
+    result.reserve(f.size());
+    for (const BigInt& c : f) {
+        result.push_back(reduceModPrime(c, p));
+    }
+    while (!result.empty() && result.back() == 0) {
+        result.pop_back();
+    }
+    return result;
+}
+
+int64_t evaluateModPrime(const std::vector<int64_t>& f, int64_t x, int64_t p) {
+    int64_t result = 0;
+    for (int i = static_cast<int>(f.size()) - 1; i >= 0; i--) {
+        result = (result * x + f[i]) % p;
+    }
+    return result;
+}
+
+//  Degree of `gcd(f, g)` over `F_p`, `-1` stands for the zero polynomial
+int gcdDegreeModPrime(std::vector<int64_t> f, std::vector<int64_t> g, int64_t p) {
+    while (!g.empty()) {
+        int64_t inv = inverseModPrime(g.back(), p);
+
+        while (f.size() >= g.size()) {
+            int64_t factor = (f.back() * inv) % p;
+            int shift = f.size() - g.size();
+            for (int i = 0; i < g.size(); i++) {
+                f[i + shift] = ((f[i + shift] - factor * g[i]) % p + p) % p;
+            }
+            while (!f.empty() && f.back() == 0) {
+                f.pop_back();
             }
         }
+        std::swap(f, g);
     }
-    return result;
+    return static_cast<int>(f.size()) - 1;
 }
 
+BigInt evaluateInteger(const std::vector<BigInt>& f, const BigInt& x, const BigInt& modulus) {
+    BigInt result = 0;
+    for (int i = static_cast<int>(f.size()) - 1; i >= 0; i--) {
+        result = (result * x + f[i]) % modulus;
+    }
+    return result < 0 ? result + modulus : result;
+}
 
-BigInt lcm(const BigInt& a, const BigInt& b) {
-    if (a == 0 || b == 0) {
-        return 0;
+BigInt inverseMod(const BigInt& a, const BigInt& modulus) {
+    BigInt r0 = modulus, r1 = a % modulus;
+    BigInt t0 = 0, t1 = 1;
+    if (r1 < 0) {
+        r1 += modulus;
     }
-    return boost::multiprecision::abs(a * b) / boost::multiprecision::gcd(a, b);
+    while (r1 != 0) {
+        BigInt q = r0 / r1;
+        BigInt r2 = r0 - q * r1;
+        BigInt t2 = t0 - q * t1;
+        r0 = std::move(r1);
+        r1 = std::move(r2);
+        t0 = std::move(t1);
+        t1 = std::move(t2);
+    }
+    return t0 < 0 ? t0 + modulus : t0;
+}
+
+/**
+ * @brief Wang's rational reconstruction. Finds `u/v` with `|u| <= N`, `0 < v <= D` and
+ * `u = r v mod M`, which is unique whenever `2ND < M`. Returns false if no such fraction exists.
+ */
+bool reconstructRational(const BigInt& r, const BigInt& M, const BigInt& N, const BigInt& D,
+                         BigInt& u, BigInt& v) {
+    BigInt r0 = M, r1 = r;
+    BigInt t0 = 0, t1 = 1;
+    while (r1 > N) {
+        BigInt q = r0 / r1;
+        BigInt r2 = r0 - q * r1;
+        BigInt t2 = t0 - q * t1;
+        r0 = std::move(r1);
+        r1 = std::move(r2);
+        t0 = std::move(t1);
+        t1 = std::move(t2);
+    }
+
+    if (t1 == 0 || boost::multiprecision::abs(t1) > D ||
+        boost::multiprecision::gcd(r1, boost::multiprecision::abs(t1)) != 1) {
+        return false;
+    }
+
+    u = t1 < 0 ? BigInt(-r1) : r1;
+    v = boost::multiprecision::abs(t1);
+    return true;
+}
+
+//  Checks `f(u/v) = 0` exactly through the homogenized sum `Σ a_i u^i v^(n-i)`
+bool isIntegerPolynomialRoot(const std::vector<BigInt>& f, const BigInt& u, const BigInt& v) {
+    BigInt result = 0;
+    BigInt vPower = 1;
+    for (int i = static_cast<int>(f.size()) - 1; i >= 0; i--) {
+        result = result * u + f[i] * vPower;
+        vPower *= v;
+    }
+    return result == 0;
 }
 
+/**
+ * @brief Finds all rational roots of `f` without enumerating divisors of its coefficients. The
+ * square-free part of `f` is scaled to a primitive integer polynomial, its roots are found modulo
+ * a small prime `p` for which it stays square-free, each of them is Hensel-lifted to precision
+ * `p^k > 2·|a_0|·|a_n|` and turned back into a fraction by rational reconstruction. Every rational
+ * root `u/v` satisfies `|u| <= |a_0|` and `v <= |a_n|`, so all of them are recovered and each
+ * candidate is verified exactly. Roots are returned in increasing order.
+ */
 std::vector<BigRational> findBigRationalRoots(const UnivariatePolynomial<BigRational>& f) {
-    if (f.degree() == 0) {
+    if (f.degree() <= 0) {
         return {};
     }
 
-    std::vector<BigInt> denominators;
-    for (const BigRational& coefficient : f.getCoefficients()) {
-        denominators.push_back(coefficient.getDenominator());
+    //  Repeated roots would make the derivative vanish modulo every prime
+    return findBigRationalRootsSquareFree(squareFreePart(f));
+}
+
+std::vector<BigRational>
+    findBigRationalRootsSquareFree(const UnivariatePolynomial<BigRational>& squareFree) {
+    if (squareFree.degree() <= 0) {
+        return {};
     }
 
-    BigInt lcm_val = denominators.front();
-    for (int i = 1; i < denominators.size(); i++) {
-        lcm_val = lcm(lcm_val, denominators[i]);
+    BigInt lcm_val = 1;
+    for (const BigRational& coefficient : squareFree.getCoefficients()) {
+        lcm_val = lcm(lcm_val, coefficient.getDenominator());
     }
 
-    UnivariatePolynomial<BigRational> g = f * BigRational(lcm_val);
-    std::vector<BigRational> coefficients = g.getCoefficients();
-    auto it = std::find_if(coefficients.begin(), coefficients.end(),
-                           [](const BigRational& r) { return r != BigRational::zero; });
-    BigRational constantTerm = *it;
-    BigRational leadingTerm = coefficients.back();
-    std::vector<BigInt> P = divisors(constantTerm.getNumerator());
-    std::vector<BigInt> Q = divisors(leadingTerm.getNumerator());
+    std::vector<BigInt> g;
+    BigInt content = 0;
+    for (const BigRational& coefficient : squareFree.getCoefficients()) {
+        g.push_back(coefficient.getNumerator() * (lcm_val / coefficient.getDenominator()));
+        content = boost::multiprecision::gcd(content, g.back());
+    }
+    for (BigInt& c : g) {
+        c /= content;
+    }
 
-    std::set<BigRational> candidates;
-    candidates.insert(BigRational::zero);
+    std::vector<BigRational> roots;
 
-    for (const BigInt& p : P) {
-        for (const BigInt& q : Q) {
-            candidates.insert(BigRational(p, q));
-            candidates.insert(BigRational(-p, q));
-        }
+    //  Square-free so `x` divides `g` at most once
+    if (g.front() == 0) {
+        roots.push_back(BigRational::zero);
+        g.erase(g.begin());
     }
 
-    std::vector<BigRational> roots;
-    int degree = g.degree();
-    int counter = 0;
+    const int degree = static_cast<int>(g.size()) - 1;
+    if (degree > 0) {
+        std::vector<BigInt> dg;
+        for (int i = 1; i <= degree; i++) {
+            dg.push_back(g[i] * i);
+        }
 
-    for (const BigRational& r : candidates) {
-        if (g.evaluate(r) == BigRational::zero) {
-            roots.push_back(r);
-            counter++;
+        //  Find a prime not dividing the leading coefficient for which `g` stays square-free
+        int64_t p = 2;
+        std::vector<int64_t> g_p;
+        while (true) {
+            if (isSmallPrime(p) && reduceModPrime(g.back(), p) != 0) {
+                g_p = reducePolynomialModPrime(g, p);
+                if (gcdDegreeModPrime(g_p, reducePolynomialModPrime(dg, p), p) == 0) {
+                    break;
+                }
+            }
+            p++;
         }
 
-        if (counter == degree) {
-            return roots;
+        BigInt N = boost::multiprecision::abs(g.front());
+        BigInt D = boost::multiprecision::abs(g.back());
+        BigInt bound = 2 * N * D;
+
+        for (int64_t r = 0; r < p; r++) {
+            if (evaluateModPrime(g_p, r, p) != 0) {
+                continue;
+            }
+
+            //  Quadratic Hensel lifting: `r ← r - g(r) / g'(r) mod m²`
+            BigInt root = r;
+            BigInt modulus = p;
+            while (modulus <= bound) {
+                modulus *= modulus;
+                BigInt correction = evaluateInteger(g, root, modulus) *
+                                    inverseMod(evaluateInteger(dg, root, modulus), modulus);
+                root = (root - correction) % modulus;
+                if (root < 0) {
+                    root += modulus;
+                }
+            }
+
+            BigInt u, v;
+            if (reconstructRational(root, modulus, N, D, u, v) &&
+                isIntegerPolynomialRoot(g, u, v)) {
+                roots.push_back(BigRational(u, v));
+            }
         }
     }
 
+    std::sort(roots.begin(), roots.end());
     return roots;
 }
@@ -2,8 +2,10 @@
 #define SOLVER_HPP
 
 #include "BigRational.hpp"
+#include "Complex.hpp"
 #include "GaloisField.hpp"
 #include "GroebnerBasis.hpp"
+#include "GroebnerWalk.hpp"
 #include "Logger.hpp"
 #include "Monomial.hpp"
 #include "MonomialOrders.hpp"
@@ -12,13 +14,29 @@
 #include "Real.hpp"
 #include "UnivariatePolynomial.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <iterator>
 #include <variant>
 
 std::vector<Rational> findRationalRoots(const UnivariatePolynomial<Rational>& f);
 std::vector<GaloisField> findGaloisFieldRoots(const UnivariatePolynomial<GaloisField>& f);
 std::vector<Real> findRealRoots(const UnivariatePolynomial<Real>& f);
 std::vector<BigRational> findBigRationalRoots(const UnivariatePolynomial<BigRational>& f);
+std::vector<Complex> findComplexRoots(const UnivariatePolynomial<Complex>& f);
+std::vector<Real> findRealRootsAberth(const UnivariatePolynomial<Real>& f);
+
+/**
+ * @brief Exact root finders for square-free `f`, they skip the square-free reduction of the ones
+ * above. Over exact fields `solveSystem` only ever passes square-free factors to its root finder,
+ * so these can be handed to it directly.
+ */
+std::vector<Rational> findRationalRootsSquareFree(const UnivariatePolynomial<Rational>& f);
+std::vector<GaloisField>
+    findGaloisFieldRootsSquareFree(const UnivariatePolynomial<GaloisField>& f);
+std::vector<BigRational>
+    findBigRationalRootsSquareFree(const UnivariatePolynomial<BigRational>& f);
 
 template<typename F>
 UnivariatePolynomial<F> fromMultivariateToUnivariate(const MultivariatePolynomial<F>& f) {
@@ -41,17 +59,58 @@ UnivariatePolynomial<F> fromMultivariateToUnivariate(const MultivariatePolynomia
     return UnivariatePolynomial(result);
 }
 
+/**
+ * @brief Roots of `f` together with their multiplicities, sorted by root. Over exact fields `f` is
+ * split into its square-free factors and `rootFinder` runs on each factor, so it only ever sees
+ * square-free polynomials and may skip its own reduction. Over floating point
+ * fields a numerical gcd is unreliable, so the multiplicity of each root is the number of
+ * derivatives of `f` that vanish there.
+ */
+template<typename F>
+std::vector<std::pair<F, int>> findRootsWithMultiplicities(
+    const UnivariatePolynomial<F>& f,
+    std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder) {
+
+    std::vector<std::pair<F, int>> result;
+    if constexpr (isExactField<F>) {
+        for (const auto& [factor, multiplicity] : squareFreeDecomposition(f)) {
+            for (const F& root : rootFinder(factor)) {
+                result.push_back({root, multiplicity});
+            }
+        }
+    }
+    else {
+        for (const F& root : rootFinder(f)) {
+            int multiplicity = 1;
+            UnivariatePolynomial<F> derivative = f.derivative();
+            while (derivative.degree() > 0 && derivative.evaluate(root) == F::zero) {
+                multiplicity++;
+                derivative = derivative.derivative();
+            }
+            result.push_back({root, multiplicity});
+        }
+    }
+
+    std::sort(result.begin(), result.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    return result;
+}
+
 /**
  * @brief For a system of polynomial equations `X`, returns the characteristic equations that each
- * variable must satisfy. If the system has no solutions returns the empty map. Requires `|X|`
- * calculations of Groebner basis.
+ * variable must satisfy. If the system has no solutions returns the empty map. Requires one
+ * Groebner basis per variable, each under a block order eliminating the other variables. They are
+ * independent and run concurrently on `numThreads` threads. As soon as one variable has no
+ * unique univariate polynomial the other computations are cancelled. Throws `OperationCancelled`
+ * if `budget` runs out.
  */
 template<typename F>
 std::map<char, MultivariatePolynomial<F>>
-    characteristicEquations(const std::vector<MultivariatePolynomial<F>>& X) {
+    characteristicEquations(const std::vector<MultivariatePolynomial<F>>& X, int numThreads = 1,
+                            const ComputationBudget& budget = {}) {
 
-    Logger::characteristicEq("🎯 === characteristicEquations CALLED ===");
-    Logger::characteristicEq("📊 System size: " + std::to_string(X.size()));
+    LOG_CHARACTERISTIC("🎯 === characteristicEquations CALLED ===");
+    LOG_CHARACTERISTIC("📊 System size: " + std::to_string(X.size()));
 
     std::map<char, MultivariatePolynomial<F>> result;
     std::set<char> varSet;
@@ -61,87 +120,157 @@ std::map<char, MultivariatePolynomial<F>>
         varSet.insert(f_vars.begin(), f_vars.end());
     }
 
-    std::string varSetStr = "🔤 All variables: ";
-    for (char v : varSet) {
-        varSetStr += v;
-        varSetStr += " ";
-    }
-    Logger::characteristicEq(varSetStr);
+    LOG_CHARACTERISTIC([&] {
+        std::string varSetStr = "🔤 All variables: ";
+        for (char v : varSet) {
+            varSetStr += v;
+            varSetStr += " ";
+        }
+        return varSetStr;
+    }());
 
     //  Edge case
     if (X.size() > 1 && varSet.size() == 1) {
-        Logger::characteristicEq(
+        LOG_CHARACTERISTIC(
             "⚠️ Edge case: Multiple polynomials with single variable - no characteristic equations");
         return {};
     }
 
-    for (char var : varSet) {
-        Logger::characteristicEq("🎪 Computing characteristic equation for variable: " +
-                                 std::string(1, var));
+    ThreadPool pool(numThreads);
+    GroebnerOptions options;
+    options.pool = &pool;
+
+    //  Own token, so stopping the other variables does not cancel the caller's token
+    options.budget = budget;
+    options.budget.cancellation = budget.cancellation.child();
+    std::atomic<bool> noUniquePolynomial(false);
 
-        std::vector<char> newPermutation;
-        std::set<char> newVarSet = varSet;
+    const std::vector<char> variables(varSet.begin(), varSet.end());
+    std::vector<MultivariatePolynomial<F>> equations(variables.size());
+
+    //  Every task copies `X` for its own order, so the shared monomials are only read and their
+    //  cached order keys are never written concurrently
+    pool.parallelFor(variables.size(), [&](int k) {
+        const char var = variables[k];
+        if (noUniquePolynomial) {
+            return;
+        }
 
-        newVarSet.erase(var);
-        newPermutation.insert(newPermutation.end(), newVarSet.begin(), newVarSet.end());
-        newPermutation.push_back(var);
+        LOG_CHARACTERISTIC("🎪 Computing characteristic equation for variable: " +
+                           std::string(1, var));
+
+        //  Only `var` has to survive the elimination, so all other variables form one block
+        //  ordered by grevlex instead of a full lex order
+        std::vector<char> eliminated;
+        std::copy_if(varSet.begin(), varSet.end(), std::back_inserter(eliminated),
+                     [var](char c) { return c != var; });
+        std::vector<std::vector<char>> blocks = {{var}};
+        if (!eliminated.empty()) {
+            blocks.insert(blocks.begin(), eliminated);
+        }
 
-        std::string permStr = "🔀 Variable order: ";
-        for (char c : newPermutation) {
-            permStr += c;
-            permStr += " ";
+        LOG_CHARACTERISTIC([&] {
+            std::string permStr = "🔀 Eliminated variables: ";
+            for (char c : eliminated) {
+                permStr += c;
+                permStr += " ";
+            }
+            return permStr;
+        }());
+
+        LOG_CHARACTERISTIC("⚙️ Calculating Groebner basis...");
+        GroebnerResult<F> groebner =
+            tryCalculateGroebnerBasis(X, BlockOrder(blocks), true, options);
+        if (!groebner.completed()) {
+            //  Cancelled by another variable, otherwise the caller's budget ran out
+            if (noUniquePolynomial) {
+                return;
+            }
+            throw OperationCancelled(*groebner.abortReason);
         }
-        Logger::characteristicEq(permStr);
 
-        Logger::characteristicEq("⚙️ Calculating Groebner basis...");
-        std::vector<MultivariatePolynomial<F>> G =
-            calculateGroebnerBasis(X, LexOrder(newPermutation));
-        Logger::characteristicEq("✨ Groebner basis computed, size: " + std::to_string(G.size()));
+        const std::vector<MultivariatePolynomial<F>>& G = groebner.basis;
+        LOG_CHARACTERISTIC("✨ Groebner basis computed, size: " + std::to_string(G.size()));
 
-        std::vector<MultivariatePolynomial<F>> H;
+        std::vector<const MultivariatePolynomial<F>*> H;
 
         for (const MultivariatePolynomial<F>& g : G) {
             std::vector<char> g_vars = g.getVariables();
-            Logger::characteristicEq("🔎 Examining basis element: " + g.toString());
+            LOG_CHARACTERISTIC_DEBUG("🔎 Examining basis element: " + g.toString());
 
             if (g_vars.size() == 1 && g_vars.front() == var) {
-                Logger::characteristicEq("🎯 Found univariate polynomial in " +
-                                         std::string(1, var));
-                H.push_back(g);
+                LOG_CHARACTERISTIC("🎯 Found univariate polynomial in " + std::string(1, var));
+                H.push_back(&g);
             }
         }
 
         if (H.size() != 1) {
-            Logger::characteristicEq("❌ Expected exactly 1 univariate polynomial, found: " +
-                                     std::to_string(H.size()));
-            return {};
+            LOG_CHARACTERISTIC("❌ Expected exactly 1 univariate polynomial, found: " +
+                               std::to_string(H.size()));
+            noUniquePolynomial = true;
+            options.budget.cancellation.cancel();
+            return;
         }
 
-        result[var] = H.front();
-        Logger::characteristicEq("✅ Characteristic equation for " + std::string(1, var) + ": " +
-                                 H.front().toString());
+        equations[k] = *H.front();
+        LOG_CHARACTERISTIC("✅ Characteristic equation for " + std::string(1, var) + ": " +
+                           H.front()->toString());
+    });
+
+    if (noUniquePolynomial) {
+        return {};
     }
 
-    Logger::characteristicEq("🎉 All characteristic equations computed successfully");
+    for (int k = 0; k < variables.size(); k++) {
+        result[variables[k]] = std::move(equations[k]);
+    }
+
+    LOG_CHARACTERISTIC("🎉 All characteristic equations computed successfully");
     return result;
 }
 
 /**
- * @brief Helper function to solve system of polynomial equations
+ * @brief Execution settings of `solveSystem`
+ */
+struct SolverOptions {
+    //  Threads shared by the Groebner basis and the branches of the search tree
+    int numThreads = 1;
+
+    //  Levels of the search tree whose root branches are spawned as separate tasks
+    int parallelDepth = 2;
+
+    //  Limits of the Groebner basis computation, deadline and cancellation also bound the search
+    ComputationBudget budget;
+
+    //  Progress of the Groebner basis computation, see `GroebnerOptions::progress`
+    ProgressReporter* progress = nullptr;
+
+    //  Counters of the Groebner basis computation, see `GroebnerOptions::stats`
+    GroebnerStats* stats = nullptr;
+};
+
+/**
+ * @brief Helper function to solve system of polynomial equations. Every root of the selected
+ * univariate polynomial opens an independent branch. With a `pool` the branches of the first
+ * `options.parallelDepth` levels run as separate tasks, deeper levels stay inside their task.
+ * Solutions are merged in root order, so the result does not depend on the scheduling. Throws
+ * `OperationCancelled` once `options.budget` is cancelled or past its deadline.
  */
 template<typename F>
 std::variant<std::string, std::vector<std::map<char, F>>>
     recursiveSolver(const std::vector<MultivariatePolynomial<F>>& X,
-                    std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder) {
-    Logger::solver("🌀 === recursiveSolver CALLED ===");
-    Logger::solver("📦 Input size: " + std::to_string(X.size()));
+                    std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder,
+                    const SolverOptions& options = {}, ThreadPool* pool = nullptr, int depth = 0) {
+    options.budget.checkpoint();
+    LOG_SOLVER("🌀 === recursiveSolver CALLED ===");
+    LOG_SOLVER("📦 Input size: " + std::to_string(X.size()));
 
     for (size_t i = 0; i < X.size(); ++i) {
-        Logger::solver("🔢 X[" + std::to_string(i) + "] = " + X[i].toString());
+        LOG_SOLVER_DEBUG("🔢 X[" + std::to_string(i) + "] = " + X[i].toString());
     }
 
     if (X.empty()) {
-        Logger::solver("⚠️ Empty system. Returning empty solution.");
+        LOG_SOLVER("⚠️ Empty system. Returning empty solution.");
         return {};
     }
 
@@ -160,120 +289,166 @@ std::variant<std::string, std::vector<std::map<char, F>>>
     }
 
     if (!constantPolynomials.empty()) {
-        Logger::solver("❌ Returning: No solutions found");
+        LOG_SOLVER("❌ Returning: No solutions found");
         return "No solutions found";
     }
     else if (univaratePolynomials.empty()) {
-        Logger::solver("♾️ No univariate polynomials left. Returning: Infinitely many solutions");
+        LOG_SOLVER("♾️ No univariate polynomials left. Returning: Infinitely many solutions");
         return "There are infinitely many solutions";
     }
 
-    MultivariatePolynomial<F> f = univaratePolynomials.front();
+    MultivariatePolynomial<F> f = std::move(univaratePolynomials.front());
     char var = f.getVariables().front();
-    Logger::solver("🎯 Selected univariate polynomial f(" + std::string(1, var) +
-                   ") = " + f.toString());
-    Logger::solver("📌 Variable selected: " + std::string(1, var));
+    LOG_SOLVER("🎯 Selected univariate polynomial f(" + std::string(1, var) + ") = " + f.toString());
+    LOG_SOLVER("📌 Variable selected: " + std::string(1, var));
 
     univaratePolynomials.erase(univaratePolynomials.begin());
-    std::vector<F> rootsFound = rootFinder(fromMultivariateToUnivariate(f));
+    std::vector<std::pair<F, int>> rootsWithMultiplicities =
+        findRootsWithMultiplicities(fromMultivariateToUnivariate(f), rootFinder);
 
-    std::string rootsStr = "   🌱 Roots found: ";
-    for (const F& r : rootsFound) {
-        rootsStr += r.toString() + " ";
+    std::vector<F> rootsFound;
+    for (const auto& [r, _] : rootsWithMultiplicities) {
+        rootsFound.push_back(r);
     }
-    Logger::solver(rootsStr);
+
+    LOG_SOLVER([&] {
+        std::string rootsStr = "   🌱 Roots found: ";
+        for (const auto& [r, multiplicity] : rootsWithMultiplicities) {
+            rootsStr += r.toString();
+            rootsStr += multiplicity > 1 ? " (×" + std::to_string(multiplicity) + ") " : " ";
+        }
+        return rootsStr;
+    }());
 
     if (rootsFound.empty()) {
-        Logger::solver("   ❌ No roots found. Returning: No solutions found");
+        LOG_SOLVER("   ❌ No roots found. Returning: No solutions found");
         return "No solutions found";
     }
 
-    std::vector<std::map<char, F>> solutions;
+    using Solutions = std::vector<std::map<char, F>>;
+    const std::string infinitelyMany = "There are infinitely many solutions";
 
-    for (const F& root : rootsFound) {
+    //  Once one branch has infinitely many solutions the remaining ones are not needed
+    std::atomic<bool> foundInfinitelyMany(false);
+    std::vector<std::variant<std::string, Solutions>> branches(rootsFound.size());
+
+    auto solveBranch = [&](int k) {
+        const F& root = rootsFound[k];
+        if (foundInfinitelyMany) {
+            branches[k] = infinitelyMany;
+            return;
+        }
+        options.budget.checkpoint();
 
         std::map<char, F> currentSolution = {
             {var, root}
         };
         std::vector<MultivariatePolynomial<F>> G;
 
-        Logger::solver("   🧪 Trying root: " + root.toString() + " for variable " + var);
-        Logger::solver("   📉 Substituting " + std::string(1, var) + " = " + root.toString() +
-                       " into all polynomials...");
+        LOG_SOLVER("   🧪 Trying root: " + root.toString() + " for variable " + var);
+        LOG_SOLVER("   📉 Substituting " + std::string(1, var) + " = " + root.toString() +
+                   " into all polynomials...");
 
         for (const MultivariatePolynomial<F>& f : X) {
 
             MultivariatePolynomial<F> g = f.substitute(var, root);
 
             if (!g.isZeroPolynomial()) {
-                G.push_back(g);
-                Logger::solver("🔁 " + f.toString() + " → " + g.toString());
+                LOG_SOLVER_DEBUG("🔁 " + f.toString() + " → " + g.toString());
+                G.push_back(std::move(g));
             }
             else {
-                Logger::solver("🐼 " + f.toString() + " → " + g.toString() + "");
+                LOG_SOLVER_DEBUG("🐼 " + f.toString() + " → " + g.toString() + "");
             }
         }
 
         if (G.empty()) {
-            Logger::solver(
+            LOG_SOLVER(
                 "   ✅ All polynomials vanished after substitution. Partial solution accepted.");
-            solutions.push_back(currentSolution);
+            branches[k] = Solutions{currentSolution};
+            return;
         }
-        else {
-            Logger::solver("   🔁 Recursively solving remaining system of size " +
-                           std::to_string(G.size()));
-            auto extendedSolution = recursiveSolver(G, rootFinder);
 
-            if (std::holds_alternative<std::string>(extendedSolution)) {
-                std::string message = std::get<std::string>(extendedSolution);
-                Logger::solver("   ⚠️ Recursive call returned a string: " + message);
+        LOG_SOLVER("   🔁 Recursively solving remaining system of size " + std::to_string(G.size()));
+        auto extendedSolution = recursiveSolver(G, rootFinder, options, pool, depth + 1);
 
-                if (message == "There are infinitely many solutions") {
-                    Logger::solver("   😡 Infinitely many solutions, system will not be solved");
-                    return "There are infinitely many solutions";
-                }
-                else {
-                    Logger::solver("   🔥 No solution found for this root = " + root.toString() +
-                                   " ,  skiping to the next");
-                    continue;
-                }
-            }
+        if (std::holds_alternative<std::string>(extendedSolution)) {
+            std::string message = std::get<std::string>(extendedSolution);
+            LOG_SOLVER("   ⚠️ Recursive call returned a string: " + message);
 
-            std::vector<std::map<char, F>> extendedSolutions =
-                std::get<std::vector<std::map<char, F>>>(extendedSolution);
+            if (message == infinitelyMany) {
+                foundInfinitelyMany = true;
+            }
+            branches[k] = std::move(message);
+            return;
+        }
 
-            for (const std::map<char, F>& sol : extendedSolutions) {
-                std::map<char, F> fullSolution = currentSolution;
-                fullSolution.insert(sol.begin(), sol.end());
+        Solutions fullSolutions;
+        for (const std::map<char, F>& sol : std::get<Solutions>(extendedSolution)) {
+            std::map<char, F> fullSolution = currentSolution;
+            fullSolution.insert(sol.begin(), sol.end());
 
+            LOG_SOLVER_DEBUG([&] {
                 std::string solStr = "   🔗 Merged solution: ";
-                for (const auto& [k, v] : fullSolution) {
-                    solStr += std::string(1, k) + " = " + v.toString() + ", ";
+                for (const auto& [variable, value] : fullSolution) {
+                    solStr += std::string(1, variable) + " = " + value.toString() + ", ";
                 }
-                Logger::solver(solStr);
-                solutions.push_back(fullSolution);
+                return solStr;
+            }());
+            fullSolutions.push_back(std::move(fullSolution));
+        }
+        branches[k] = std::move(fullSolutions);
+    };
+
+    //  Branches only read `X`, substituting builds new monomials, so no cached order key of a
+    //  shared monomial is written concurrently
+    if (pool != nullptr && depth < options.parallelDepth) {
+        pool->parallelFor(rootsFound.size(), solveBranch);
+    }
+    else {
+        for (int k = 0; k < rootsFound.size(); k++) {
+            solveBranch(k);
+        }
+    }
+
+    Solutions solutions;
+    for (int k = 0; k < rootsFound.size(); k++) {
+        if (std::holds_alternative<std::string>(branches[k])) {
+            if (std::get<std::string>(branches[k]) == infinitelyMany) {
+                LOG_SOLVER("   😡 Infinitely many solutions, system will not be solved");
+                return infinitelyMany;
             }
+
+            LOG_SOLVER("   🔥 No solution found for this root = " + rootsFound[k].toString() +
+                       " ,  skiping to the next");
+            continue;
+        }
+
+        for (std::map<char, F>& solution : std::get<Solutions>(branches[k])) {
+            solutions.push_back(std::move(solution));
         }
     }
 
-    Logger::solver("🧾 Returning " + std::to_string(solutions.size()) + " solution(s)");
+    LOG_SOLVER("🧾 Returning " + std::to_string(solutions.size()) + " solution(s)");
     return solutions;
 }
 
 /**
  * @brief Solves system of polynomial equations. If there are solutions returns vector of them.
- * Otherwise string with coressponding message is returned.
+ * Otherwise string with coressponding message is returned, also when `options.budget` runs out.
+ * Over exact fields `rootFinder` only receives square-free polynomials, see
+ * `findRootsWithMultiplicities`.
  */
 template<typename F>
 std::variant<std::string, std::vector<std::map<char, F>>>
     solveSystem(const std::vector<MultivariatePolynomial<F>>& X,
-                std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder) {
-
-    Logger::solver("🚀 === solveSystem CALLED ===");
-    Logger::solver("📥 System size: " + std::to_string(X.size()));
+                std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder,
+                const SolverOptions& options = {}) {
+    LOG_SOLVER("🚀 === solveSystem CALLED ===");
+    LOG_SOLVER("📥 System size: " + std::to_string(X.size()));
 
     if (X.empty()) {
-        Logger::solver("❌ Empty system not allowed");
+        LOG_SOLVER("❌ Empty system not allowed");
         return "Empty system is not allowed";
     }
 
@@ -281,29 +456,110 @@ std::variant<std::string, std::vector<std::map<char, F>>>
     for (const MultivariatePolynomial<F>& f : X) {
         std::vector<char> f_vars = f.getVariables();
         varSet.insert(f_vars.begin(), f_vars.end());
-        Logger::solver("📝 Input polynomial: " + f.toString());
+        LOG_SOLVER_DEBUG("📝 Input polynomial: " + f.toString());
     }
 
     std::vector<char> variables(varSet.begin(), varSet.end());
-    std::string varStr = "🎲 Variables in system: ";
-    for (char v : variables) {
-        varStr += v;
-        varStr += " ";
-    }
-    Logger::solver(varStr);
+    LOG_SOLVER([&] {
+        std::string varStr = "🎲 Variables in system: ";
+        for (char v : variables) {
+            varStr += v;
+            varStr += " ";
+        }
+        return varStr;
+    }());
 
     //  Hilbert Nullstellensatz
-    Logger::solver("⚙️ Computing Groebner basis for Nullstellensatz check...");
-    std::vector<MultivariatePolynomial<F>> G = calculateGroebnerBasis(X, LexOrder(variables));
-    Logger::solver("✨ Groebner basis computed, size: " + std::to_string(G.size()));
+    LOG_SOLVER("⚙️ Computing Groebner basis for Nullstellensatz check...");
+    ThreadPool pool(options.numThreads);
+    GroebnerOptions groebnerOptions;
+    groebnerOptions.pool = &pool;
+    groebnerOptions.budget = options.budget;
+    groebnerOptions.progress = options.progress;
+    groebnerOptions.stats = options.stats;
+
+    //  Over exact fields the lex basis is walked to from the much cheaper grevlex basis, with
+    //  floating point coefficients the extra reductions of the walk only add rounding errors
+    GroebnerResult<F> groebner = [&] {
+        if constexpr (isExactField<F>) {
+            return tryCalculateGroebnerBasis(X, GradedRevLexOrder(variables), true,
+                                             groebnerOptions);
+        }
+        else {
+            return tryCalculateGroebnerBasis(X, LexOrder(variables), true, groebnerOptions);
+        }
+    }();
+    if (!groebner.completed()) {
+        LOG_SOLVER("🛑 Groebner basis aborted after " + std::to_string(groebner.stats.pairsReduced) +
+                   " reductions");
+        return "Computation aborted: " + toString(*groebner.abortReason);
+    }
+
+    if constexpr (isExactField<F>) {
+        try {
+            groebner.basis =
+                groebnerWalk(std::move(groebner.basis), MatrixOrder::gradedRevLex(variables),
+                             MatrixOrder::lex(variables), groebnerOptions);
+        }
+        catch (const OperationCancelled& e) {
+            LOG_SOLVER("🛑 Groebner walk aborted: " + toString(e.reason()));
+            return "Computation aborted: " + toString(e.reason());
+        }
+        catch (const std::overflow_error&) {
+            LOG_SOLVER("⚠️ Groebner walk weights overflow, computing the lex basis directly");
+            groebner = tryCalculateGroebnerBasis(X, LexOrder(variables), true, groebnerOptions);
+            if (!groebner.completed()) {
+                return "Computation aborted: " + toString(*groebner.abortReason);
+            }
+        }
+    }
+
+    const std::vector<MultivariatePolynomial<F>>& G = groebner.basis;
+    LOG_SOLVER("✨ Groebner basis computed, size: " + std::to_string(G.size()));
 
     if (G.size() == 1 && G.front() == F::one) {
-        Logger::solver("🚫 Nullstellensatz: System has no solutions in any field extension");
+        LOG_SOLVER("🚫 Nullstellensatz: System has no solutions in any field extension");
         return "No solution exist in any field extension";
     }
 
-    Logger::solver("🔄 Proceeding to recursive solver...");
-    return recursiveSolver(G, rootFinder);
+    LOG_SOLVER("🔄 Proceeding to recursive solver...");
+    try {
+        return recursiveSolver(G, rootFinder, options, &pool);
+    }
+    catch (const OperationCancelled& e) {
+        LOG_SOLVER("🛑 Search aborted: " + toString(e.reason()));
+        return "Computation aborted: " + toString(e.reason());
+    }
+}
+
+/**
+ * @brief Solves the system whose lex Groebner basis `basis` maintains. After adding a constraint
+ * with `GroebnerBasis::addGenerator` only the pairs of the new generator are reduced again.
+ */
+template<typename F>
+std::variant<std::string, std::vector<std::map<char, F>>>
+    solveSystem(GroebnerBasis<F, LexOrder>& basis,
+                std::function<std::vector<F>(const UnivariatePolynomial<F>&)> rootFinder,
+                const SolverOptions& options = {}) {
+    LOG_SOLVER("🚀 === solveSystem CALLED on a maintained Groebner basis ===");
+
+    try {
+        const std::vector<MultivariatePolynomial<F>>& G = basis.basis();
+        if (G.empty()) {
+            return "Empty system is not allowed";
+        }
+        if (G.size() == 1 && G.front() == F::one) {
+            LOG_SOLVER("🚫 Nullstellensatz: System has no solutions in any field extension");
+            return "No solution exist in any field extension";
+        }
+
+        ThreadPool pool(options.numThreads);
+        return recursiveSolver(G, rootFinder, options, &pool);
+    }
+    catch (const OperationCancelled& e) {
+        LOG_SOLVER("🛑 Search aborted: " + toString(e.reason()));
+        return "Computation aborted: " + toString(e.reason());
+    }
 }
 
 template<typename F>
@@ -1,4 +1,5 @@
 #include "BigRational.hpp"
+#include "Complex.hpp"
 #include "GaloisField.hpp"
 #include "Monomial.hpp"
 #include "Rational.hpp"
@@ -17,9 +18,14 @@ const GaloisField GaloisField::one = GaloisField(1);
 const Real Real::zero = Real(0.0);
 const Real Real::one = Real(1.0);
 
+const Complex Complex::zero = Complex(0.0);
+const Complex Complex::one = Complex(1.0);
+
 const BigRational BigRational::zero = BigRational(0);
 const BigRational BigRational::one = BigRational(1);
 
 int64_t GaloisField::prime = 2;
 
-double Real::epsilon = 1e-7;
\ No newline at end of file
+double Real::epsilon = 1e-7;
+
+double Complex::epsilon = 1e-7;
\ No newline at end of file
@@ -0,0 +1,196 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Work-stealing thread pool. Every worker owns a deque of tasks: it pops new work from the
+ * back of its own deque and, once that is empty, steals from the front of the others. A thread
+ * waiting for its tasks keeps executing queued tasks instead of blocking, so tasks may submit and
+ * wait for nested tasks without deadlocking the pool.
+ *
+ * A pool of `numThreads` runs `numThreads - 1` background workers next to the calling thread.
+ * Builds without thread support (WebAssembly without pthreads) always run on the calling thread.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(int numThreads) {
+        const int workers = threadsSupported ? std::max(numThreads, 1) - 1 : 0;
+
+        //  Queue 0 belongs to the threads outside of the pool
+        for (int i = 0; i <= workers; i++) {
+            _queues.push_back(std::make_unique<_Queue>());
+        }
+        for (int i = 1; i <= workers; i++) {
+            _threads.emplace_back([this, i] { _workerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    //  Number of threads executing tasks, the calling thread included
+    int size() const { return _threads.size() + 1; }
+
+    /**
+     * @brief Calls `body(i)` for every `i` in `[0; count)` and returns once all calls finished.
+     * The first exception thrown by `body` is rethrown after the remaining calls completed.
+     */
+    template<typename Function> void parallelFor(int count, const Function& body) {
+        if (_threads.empty() || count <= 1) {
+            for (int i = 0; i < count; i++) {
+                body(i);
+            }
+            return;
+        }
+
+        std::atomic<int> remaining(count);
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+
+        const int self = _ownerIndex();
+        for (int i = 0; i < count; i++) {
+            //  Tasks are spread over all deques up front, stealing balances the rest
+            const int queue = (self + i) % _queues.size();
+            _push(queue, [&, i] {
+                try {
+                    body(i);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        //  Help instead of blocking, nested `parallelFor` calls rely on this
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (!_runOne(self)) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    //  Number of hardware threads, at least 1
+    static int hardwareConcurrency() {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    constexpr static bool threadsSupported = false;
+#else
+    constexpr static bool threadsSupported = true;
+#endif
+
+private:
+    struct _Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<_Queue>> _queues;
+    std::vector<std::thread> _threads;
+
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    int _queued = 0;
+    bool _stop = false;
+
+    //  Index of the deque owned by the current thread in this pool, `0` for outside threads
+    inline static thread_local const ThreadPool* _currentPool = nullptr;
+    inline static thread_local int _currentIndex = 0;
+
+    int _ownerIndex() const { return _currentPool == this ? _currentIndex : 0; }
+
+    void _push(int queue, std::function<void()> task) {
+        //  Counted before it becomes visible, so the counter never drops below zero
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _queued++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_queues[queue]->mutex);
+            _queues[queue]->tasks.push_back(std::move(task));
+        }
+        _wake.notify_one();
+    }
+
+    //  Runs one task from the own deque or, if empty, one stolen from another deque
+    bool _runOne(int self) {
+        std::function<void()> task;
+        const int n = _queues.size();
+
+        for (int k = 0; k < n && !task; k++) {
+            _Queue& queue = *_queues[(self + k) % n];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (k == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+        }
+
+        if (!task) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _queued--;
+        }
+        task();
+        return true;
+    }
+
+    void _workerLoop(int index) {
+        _currentPool = this;
+        _currentIndex = index;
+
+        while (true) {
+            if (_runOne(index)) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _wake.wait(lock, [this] { return _stop || _queued > 0; });
+            if (_stop) {
+                return;
+            }
+        }
+    }
+};
+
+#endif //  THREAD_POOL_HPP
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -375,6 +376,24 @@ public:
         return result;
     }
 
+    /**
+     * @brief Evaluates the polynomial at every point of `points` with Horner's scheme run in
+     * lockstep over all points, a flat loop the compiler can vectorize. A subproduct tree only
+     * pays off with fast multiplication: built from the schoolbook products here it was slower
+     * than this loop at every degree and batch size measured, both over `GF(p)` and the rationals.
+     */
+    std::vector<F> evaluateMany(const std::vector<F>& points) const {
+        std::vector<F> result(points.size(), _coefficients.back());
+        for (int i = _coefficients.size() - 2; i >= 0; i--) {
+            const F& coeff = _coefficients[i];
+            for (int j = 0; j < points.size(); j++) {
+                result[j] *= points[j];
+                result[j] += coeff;
+            }
+        }
+        return result;
+    }
+
     //  Power operation
     UnivariatePolynomial power(int exp) const {
         if (exp == 0) {
@@ -487,24 +506,29 @@ private:
             return {UnivariatePolynomial(), *this};
         }
 
-        UnivariatePolynomial dividend = *this;
-        UnivariatePolynomial quotient;
+        //  Classical long division working in place on the remainder coefficients
+        const int m = divisor.degree();
+        const int quotientDegree = degree() - m;
+        const std::vector<F>& d = divisor._coefficients;
+        std::vector<F> remainder = _coefficients;
+        std::vector<F> quotient(quotientDegree + 1, F::zero);
         F leadingCoeffInv = divisor.leadingCoefficient().multiplicativeInverse();
 
-        while (!dividend.isZeroPolynomial() && dividend.degree() >= divisor.degree()) {
-
-            F coeffRatio = dividend.leadingCoefficient() * leadingCoeffInv;
-            int degreeDiff = dividend.degree() - divisor.degree();
-
-            std::vector<F> monomialCoeffs(degreeDiff + 1, F::zero);
-            monomialCoeffs[degreeDiff] = coeffRatio;
-            UnivariatePolynomial monomial(std::move(monomialCoeffs));
+        for (int i = quotientDegree; i >= 0; i--) {
+            F coeffRatio = remainder[i + m] * leadingCoeffInv;
+            if (coeffRatio == F::zero) {
+                continue;
+            }
 
-            quotient += monomial;
-            dividend -= divisor * monomial;
+            quotient[i] = coeffRatio;
+            for (int j = 0; j < m; j++) {
+                remainder[i + j] -= coeffRatio * d[j];
+            }
         }
 
-        return {quotient, dividend};
+        remainder.resize(m);
+        return {UnivariatePolynomial(std::move(quotient)),
+                UnivariatePolynomial(std::move(remainder))};
     }
 
     std::string _toSuperscript(int num) const {
@@ -541,4 +565,103 @@ template<typename F> UnivariatePolynomial<F> makeMonomial(const F& coefficient,
     return UnivariatePolynomial<F>(std::move(coeffs));
 }
 
+/**
+ * @brief Monic greatest common divisor of `f` and `g` computed with the Euclidean algorithm.
+ * Remainders are kept monic so that coefficients stay small. Returns the zero polynomial only if
+ * both arguments are zero.
+ */
+template<typename F>
+UnivariatePolynomial<F> gcd(const UnivariatePolynomial<F>& f, const UnivariatePolynomial<F>& g) {
+    UnivariatePolynomial<F> a = f.isZeroPolynomial() ? f : f.makeMonic();
+    UnivariatePolynomial<F> b = g.isZeroPolynomial() ? g : g.makeMonic();
+
+    while (!b.isZeroPolynomial()) {
+        UnivariatePolynomial<F> r = a % b;
+        a = std::move(b);
+        b = r.isZeroPolynomial() ? std::move(r) : r.makeMonic();
+    }
+
+    return a;
+}
+
+/**
+ * @brief Square-free decomposition `f = lc(f) · ∏ g_i^(m_i)` with monic, square-free and pairwise
+ * coprime factors `g_i`, returned as pairs `(g_i, m_i)` in increasing order of multiplicity. Uses
+ * the classical repeated-gcd scheme of Musser together with its p-th root step, so factors whose
+ * multiplicity is divisible by the characteristic of a finite prime field are found as well.
+ */
+template<typename F>
+std::vector<std::pair<UnivariatePolynomial<F>, int>>
+    squareFreeDecomposition(const UnivariatePolynomial<F>& f) {
+    std::vector<std::pair<UnivariatePolynomial<F>, int>> result;
+    if (f.degree() <= 0) {
+        return result;
+    }
+
+    UnivariatePolynomial<F> c = gcd(f, f.derivative());
+    UnivariatePolynomial<F> w = (f / c).makeMonic();
+
+    int multiplicity = 1;
+    while (w.degree() > 0) {
+        UnivariatePolynomial<F> y = gcd(w, c);
+        UnivariatePolynomial<F> z = w / y;
+        if (z.degree() > 0) {
+            result.push_back({z.makeMonic(), multiplicity});
+        }
+        multiplicity++;
+        w = std::move(y);
+        c = c / w;
+    }
+
+    //  What is left has zero derivative, `c(x) = h(x^p) = h(x)^p` over the prime field `F_p`
+    if (c.degree() > 0) {
+        int exponentGcd = 0;
+        for (int i = 1; i <= c.degree(); i++) {
+            if (c[i] != F::zero) {
+                exponentGcd = std::gcd(exponentGcd, i);
+            }
+        }
+
+        int p = 2;
+        while (p <= exponentGcd &&
+               (exponentGcd % p != 0 || F(static_cast<int64_t>(p)) != F::zero)) {
+            p++;
+        }
+
+        //  Only reachable through rounding in characteristic zero, keep the remainder as is
+        if (p > exponentGcd) {
+            result.push_back({c, multiplicity});
+            return result;
+        }
+
+        std::vector<F> root;
+        for (int i = 0; i <= c.degree(); i += p) {
+            root.push_back(c[i]);
+        }
+
+        for (auto& [g, m] : squareFreeDecomposition(UnivariatePolynomial<F>(std::move(root)))) {
+            result.push_back({std::move(g), m * p});
+        }
+        std::stable_sort(result.begin(), result.end(),
+                         [](const auto& a, const auto& b) { return a.second < b.second; });
+    }
+
+    return result;
+}
+
+/**
+ * @brief Monic polynomial with the same roots as `f`, each of them simple
+ */
+template<typename F> UnivariatePolynomial<F> squareFreePart(const UnivariatePolynomial<F>& f) {
+    if (f.degree() <= 0) {
+        return f;
+    }
+
+    UnivariatePolynomial<F> result(F::one);
+    for (const auto& [g, _] : squareFreeDecomposition(f)) {
+        result *= g;
+    }
+    return result;
+}
+
 #endif //  UNIVARIATE_POLYNOMIAL_HPP
\ No newline at end of file
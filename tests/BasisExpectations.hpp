@@ -0,0 +1,20 @@
+#ifndef BASIS_EXPECTATIONS_HPP
+#define BASIS_EXPECTATIONS_HPP
+
+#include "MultivariatePolynomial.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+//  Reduced bases are unique, only the order of their elements may differ
+template<typename F>
+void expectSameBasis(const std::vector<MultivariatePolynomial<F>>& actual,
+                     const std::vector<MultivariatePolynomial<F>>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (const MultivariatePolynomial<F>& g : expected) {
+        EXPECT_TRUE(std::find(actual.begin(), actual.end(), g) != actual.end()) << g.toString();
+    }
+}
+
+#endif //  BASIS_EXPECTATIONS_HPP
@@ -240,4 +240,162 @@ TEST_F(GroebnerBasisTests, GroebnerBasis6) {
     EXPECT_TRUE(std::find(G.begin(), G.end(), g6) != G.end());
     EXPECT_TRUE(std::find(G.begin(), G.end(), g7) != G.end());
     EXPECT_TRUE(std::find(G.begin(), G.end(), g8) != G.end());
-}
\ No newline at end of file
+}
+
+TEST_F(GroebnerBasisTests, ParallelGroebnerBasis) {
+    auto f1 = 3 * (X ^ 2) + 2 * Y * Z - 2 * X * T;
+    auto f2 = 2 * X * Z - 2 * Y * T;
+    auto f3 = 2 * X * Y - 2 * Z - 2 * Z * T;
+    auto f4 = (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1;
+    std::vector<MultivariatePolynomial<BigRational>> F = {f1, f2, f3, f4};
+
+    GroebnerOptions options;
+    options.numThreads = 4;
+    auto serial = extendToGroebnerBasis(F, *big_lexTXYZ);
+    auto parallel = extendToGroebnerBasis(F, *big_lexTXYZ, options);
+
+    //  Remainders are merged in pair order, so even the unreduced bases match
+    EXPECT_EQ(parallel, serial);
+    EXPECT_EQ(calculateGroebnerBasis(F, *big_lexTXYZ, true, options),
+              calculateGroebnerBasis(F, *big_lexTXYZ));
+}
+
+TEST_F(GroebnerBasisTests, ComputationBudget) {
+    auto f1 = 3 * (X ^ 2) + 2 * Y * Z - 2 * X * T;
+    auto f2 = 2 * X * Z - 2 * Y * T;
+    auto f3 = 2 * X * Y - 2 * Z - 2 * Z * T;
+    auto f4 = (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1;
+    std::vector<MultivariatePolynomial<BigRational>> F = {f1, f2, f3, f4};
+
+    GroebnerResult<BigRational> complete = tryCalculateGroebnerBasis(F, *big_lexTXYZ);
+    ASSERT_TRUE(complete.completed());
+    EXPECT_EQ(complete.basis, calculateGroebnerBasis(F, *big_lexTXYZ));
+    EXPECT_EQ(complete.stats.pairsConsidered,
+              complete.stats.lcmSkipped + complete.stats.chainSkipped +
+                  complete.stats.pairsReduced);
+
+    GroebnerOptions options;
+    options.budget.maxPairs = 3;
+    GroebnerResult<BigRational> result = tryCalculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+    EXPECT_EQ(result.abortReason, AbortReason::PairLimitExceeded);
+    EXPECT_EQ(result.stats.pairsReduced, 3);
+    EXPECT_GE(result.basis.size(), F.size());
+    EXPECT_THROW(extendToGroebnerBasis(F, *big_lexTXYZ, options), OperationCancelled);
+
+    options = {};
+    options.budget.maxBasisSize = 6;
+    result = tryCalculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+    EXPECT_EQ(result.abortReason, AbortReason::BasisSizeExceeded);
+    EXPECT_GT(result.basis.size(), 6);
+
+    options = {};
+    options.budget.maxCoefficientBits = 8;
+    result = tryCalculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+    EXPECT_EQ(result.abortReason, AbortReason::CoefficientBitsExceeded);
+
+    options = {};
+    options.budget = ComputationBudget::withTimeout(std::chrono::seconds(0));
+    result = tryCalculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+    EXPECT_EQ(result.abortReason, AbortReason::DeadlineExceeded);
+    EXPECT_EQ(result.basis, F);
+
+    options = {};
+    options.numThreads = 4;
+    options.budget.cancellation.cancel();
+    result = tryCalculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+    EXPECT_EQ(result.abortReason, AbortReason::Cancelled);
+}
+
+TEST_F(GroebnerBasisTests, GroebnerStats) {
+    auto f1 = 3 * (X ^ 2) + 2 * Y * Z - 2 * X * T;
+    auto f2 = 2 * X * Z - 2 * Y * T;
+    auto f3 = 2 * X * Y - 2 * Z - 2 * Z * T;
+    auto f4 = (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1;
+    std::vector<MultivariatePolynomial<BigRational>> F = {f1, f2, f3, f4};
+
+    GroebnerStats stats;
+    GroebnerOptions options;
+    options.stats = &stats;
+    std::vector<MultivariatePolynomial<BigRational>> G =
+        calculateGroebnerBasis(F, *big_lexTXYZ, true, options);
+
+    EXPECT_EQ(stats.pairsConsidered, stats.lcmSkipped + stats.chainSkipped + stats.pairsReduced);
+    EXPECT_EQ(stats.reducedBasisSize, G.size());
+    EXPECT_GE(stats.basisSize, G.size());
+    EXPECT_GE(stats.reductionSteps, stats.pairsReduced - stats.zeroReductions);
+    EXPECT_GT(stats.maxDegree, 2);
+    EXPECT_GT(stats.maxCoefficientBits, 2);
+    EXPECT_GE(stats.peakTerms, f4.termCount());
+    EXPECT_EQ(stats.iterationStats.size(), stats.iterations);
+    EXPECT_EQ(stats.phases.size(), 2 * stats.iterations + 1);
+    EXPECT_EQ(stats.phases.back().name, "interreduction");
+
+    int64_t newPolynomials = 0;
+    for (const GroebnerStats::Iteration& iteration : stats.iterationStats) {
+        newPolynomials += iteration.newPolynomials;
+    }
+    EXPECT_EQ(stats.basisSize, F.size() + newPolynomials);
+
+    std::string json = toJson(stats);
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_NE(json.find("\"reductionSteps\":" + std::to_string(stats.reductionSteps)),
+              std::string::npos);
+
+    std::string trace = toChromeTrace(stats);
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"interreduction\""), std::string::npos);
+}
+
+TEST_F(GroebnerBasisTests, IncrementalGroebnerBasis) {
+    const LexOrder order({'T', 'X', 'Y', 'Z'});
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1, X * Y - Z, X - (Y ^ 2) + T, T * Z - 1};
+
+    GroebnerStats stats;
+    GroebnerOptions options;
+    options.stats = &stats;
+    GroebnerBasis<BigRational> G(order, options);
+
+    std::vector<MultivariatePolynomial<BigRational>> generators;
+    for (const MultivariatePolynomial<BigRational>& f : F) {
+        generators.push_back(f);
+        EXPECT_TRUE(G.addGenerator(f));
+
+        const auto expected = calculateGroebnerBasis(generators, order);
+        ASSERT_EQ(G.basis().size(), expected.size());
+        for (const MultivariatePolynomial<BigRational>& g : expected) {
+            EXPECT_TRUE(std::find(G.basis().begin(), G.basis().end(), g) != G.basis().end());
+        }
+    }
+    EXPECT_EQ(stats.iterations, F.size());
+    EXPECT_EQ(stats.reducedBasisSize, G.basis().size());
+
+    //  Members of the ideal leave the basis and the counters untouched
+    const int64_t pairsConsidered = G.stats().pairsConsidered;
+    EXPECT_FALSE(G.addGenerator(F[0] * F[1] + (X ^ 3) * F[3]));
+    EXPECT_EQ(G.stats().pairsConsidered, pairsConsidered);
+
+    GroebnerBasis<BigRational> unit({X - Y - 3, Z * T}, order);
+    EXPECT_TRUE(unit.addGenerator(X - Y + 1));
+    EXPECT_FALSE(unit.addGenerator(Z));
+    ASSERT_EQ(unit.basis().size(), 1);
+    EXPECT_EQ(unit.basis().front(), BigRational(1));
+}
+
+TEST_F(GroebnerBasisTests, Interreduction) {
+    auto g1 = x + y + z - 1;
+    auto g2 = (y ^ 2) + (z ^ 2) + y * z - y - z - 1;
+    auto g3 = (z ^ 3) - (z ^ 2) - z;
+
+    //  Reducible tails, a redundant element and a non-monic one
+    std::vector<MultivariatePolynomial<Rational>> G = {g1 + g3, 2 * y * g3, g2 + g3, 3 * g3};
+    const auto H = reduceGroebnerBasis(G, *lexXYZ, true);
+    ASSERT_EQ(H.size(), 3);
+    EXPECT_EQ(H[0], g1);
+    EXPECT_EQ(H[1], g2);
+    EXPECT_EQ(H[2], g3);
+
+    const auto unnormalized = reduceGroebnerBasis(std::move(G), *lexXYZ, false);
+    ASSERT_EQ(unnormalized.size(), 3);
+    EXPECT_EQ(unnormalized[2], 3 * g3);
+}
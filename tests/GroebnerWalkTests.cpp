@@ -0,0 +1,121 @@
+#include "BasisExpectations.hpp"
+#include "BigRational.hpp"
+#include "GaloisField.hpp"
+#include "GroebnerBasis.hpp"
+#include "GroebnerWalk.hpp"
+#include "MonomialOrders.hpp"
+#include "MultivariatePolynomial.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+class GroebnerWalkTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        X = defineVariable<BigRational>('X');
+        Y = defineVariable<BigRational>('Y');
+        Z = defineVariable<BigRational>('Z');
+    }
+
+    MultivariatePolynomial<BigRational> X;
+    MultivariatePolynomial<BigRational> Y;
+    MultivariatePolynomial<BigRational> Z;
+
+    const std::vector<char> variables = {'X', 'Y', 'Z'};
+};
+
+TEST_F(GroebnerWalkTests, MatrixFactoriesMatchOrders) {
+    const MatrixOrder lex = MatrixOrder::lex(variables);
+    const MatrixOrder gradedRevLex = MatrixOrder::gradedRevLex(variables);
+    const std::vector<Monomial> monomials = {
+        Monomial("X^2"), Monomial("XY"), Monomial("Y^2"), Monomial("XZ"), Monomial("YZ"),
+        Monomial("Z^3"), Monomial("X"),  Monomial("Z"),   Monomial()};
+
+    for (const Monomial& a : monomials) {
+        for (const Monomial& b : monomials) {
+            EXPECT_EQ(lex.compare(a, b), LexOrder(variables).compare(a, b));
+            EXPECT_EQ(gradedRevLex.compare(a, b),
+                      GradedRevLexOrder(variables).compare(a, b));
+        }
+    }
+}
+
+TEST_F(GroebnerWalkTests, GradedRevLexToLex) {
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        X + 2 * Y + 2 * Z - 1, (X ^ 2) + 2 * (Y ^ 2) + 2 * (Z ^ 2) - X,
+        2 * X * Y + 2 * Y * Z - Y};
+
+    const auto G = calculateGroebnerBasis(F, GradedRevLexOrder(variables));
+    const auto walked =
+        groebnerWalk(G, MatrixOrder::gradedRevLex(variables), MatrixOrder::lex(variables));
+
+    expectSameBasis(walked, calculateGroebnerBasis(F, LexOrder(variables)));
+}
+
+TEST_F(GroebnerWalkTests, PositiveDimensional) {
+    //  The twisted cubic with an extra surface through it
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        X * Z - (Y ^ 2), (Y ^ 3) - (Z ^ 2) * X + Y, X * Y - Z};
+
+    const auto G = calculateGroebnerBasis(F, GradedRevLexOrder(variables));
+    const auto walked =
+        groebnerWalk(G, MatrixOrder::gradedRevLex(variables), MatrixOrder::lex(variables));
+
+    expectSameBasis(walked, calculateGroebnerBasis(F, LexOrder(variables)));
+}
+
+TEST_F(GroebnerWalkTests, BetweenPermutations) {
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1, X * Y - Z, (Z ^ 2) - X + Y};
+    const std::vector<char> reversed = {'Z', 'Y', 'X'};
+
+    const auto G = calculateGroebnerBasis(F, LexOrder(variables));
+    const auto walked = groebnerWalk(G, MatrixOrder::lex(variables), MatrixOrder::lex(reversed));
+    expectSameBasis(walked, calculateGroebnerBasis(F, LexOrder(reversed)));
+
+    const auto back =
+        groebnerWalk(walked, MatrixOrder::lex(reversed), MatrixOrder::gradedRevLex(variables));
+    expectSameBasis(back, calculateGroebnerBasis(F, GradedRevLexOrder(variables)));
+}
+
+TEST_F(GroebnerWalkTests, OverGaloisField) {
+    GaloisField::setPrime(32'003);
+    const auto x = defineVariable<GaloisField>('x');
+    const auto y = defineVariable<GaloisField>('y');
+    const std::vector<char> xy = {'x', 'y'};
+    const std::vector<MultivariatePolynomial<GaloisField>> F = {
+        (x ^ 4) + (y ^ 4) - 17, (x ^ 5) + (y ^ 5) - 33};
+
+    const auto G = calculateGroebnerBasis(F, GradedRevLexOrder(xy));
+    const auto walked = groebnerWalk(G, MatrixOrder::gradedRevLex(xy), MatrixOrder::lex(xy));
+
+    expectSameBasis(walked, calculateGroebnerBasis(F, LexOrder(xy)));
+}
+
+TEST_F(GroebnerWalkTests, TrivialIdeals) {
+    const MatrixOrder source = MatrixOrder::gradedRevLex(variables);
+    const MatrixOrder target = MatrixOrder::lex(variables);
+
+    EXPECT_TRUE(groebnerWalk<BigRational>({}, source, target).empty());
+
+    const std::vector<MultivariatePolynomial<BigRational>> unit = {
+        MultivariatePolynomial<BigRational>(1)};
+    expectSameBasis(groebnerWalk(unit, source, target), unit);
+}
+
+TEST_F(GroebnerWalkTests, DifferentVariables) {
+    const std::vector<MultivariatePolynomial<BigRational>> G = {X - Y};
+    EXPECT_THROW(groebnerWalk(G, MatrixOrder::lex({'X', 'Y'}), MatrixOrder::lex({'X', 'Z'})),
+                 std::invalid_argument);
+}
+
+TEST_F(GroebnerWalkTests, CrossingOverflow) {
+    //  Both candidates weigh about 2^65 under each weight, their cross products exceed 2^127
+    const std::vector<MultivariatePolynomial<BigRational>> G = {
+        (X ^ 8) + (X ^ 4) * (Y ^ 4) + (Y ^ 8)};
+    const int64_t large = int64_t(1) << 62;
+    EXPECT_THROW(GroebnerWalkDetail::nextCrossing(G, MatrixOrder::lex({'X', 'Y'}), {large, 1},
+                                                  {1, large}),
+                 std::overflow_error);
+}
@@ -0,0 +1,118 @@
+#include "BasisExpectations.hpp"
+#include "BigRational.hpp"
+#include "GroebnerBasis.hpp"
+#include "HilbertSeries.hpp"
+#include "MonomialOrders.hpp"
+#include "MultivariatePolynomial.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+class HilbertSeriesTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        X = defineVariable<BigRational>('X');
+        Y = defineVariable<BigRational>('Y');
+        Z = defineVariable<BigRational>('Z');
+        W = defineVariable<BigRational>('W');
+    }
+
+    MultivariatePolynomial<BigRational> X;
+    MultivariatePolynomial<BigRational> Y;
+    MultivariatePolynomial<BigRational> Z;
+    MultivariatePolynomial<BigRational> W;
+
+    const std::vector<char> variables = {'X', 'Y', 'Z', 'W'};
+};
+
+TEST_F(HilbertSeriesTests, Numerator) {
+    EXPECT_EQ(HilbertSeries({}, 2).numerator(), std::vector<int64_t>({1}));
+    EXPECT_EQ(HilbertSeries({Monomial("x^2"), Monomial("y^3")}, 2).numerator(),
+              std::vector<int64_t>({1, 0, -1, -1, 0, 1}));
+    EXPECT_EQ(HilbertSeries({Monomial("x^2"), Monomial("xy")}, 2).numerator(),
+              std::vector<int64_t>({1, 0, -2, 1}));
+    EXPECT_TRUE(HilbertSeries({Monomial(), Monomial("x")}, 2).numerator().empty());
+}
+
+TEST_F(HilbertSeriesTests, DimensionCountsStandardMonomials) {
+    const std::vector<Monomial> generators = {Monomial("x^2y"), Monomial("xy^2z"),
+                                              Monomial("z^3"), Monomial("y^4"),
+                                              Monomial("x^3z")};
+    const HilbertSeries series(generators, 3);
+
+    for (int degree = 0; degree <= 8; degree++) {
+        int64_t standard = 0;
+        for (int a = 0; a <= degree; a++) {
+            for (int b = 0; a + b <= degree; b++) {
+                const Monomial m(std::map<char, int>{{'x', a}, {'y', b}, {'z', degree - a - b}});
+                standard += std::none_of(generators.begin(), generators.end(), [&](const auto& g) {
+                    return Monomial::divides(m, g);
+                });
+            }
+        }
+        EXPECT_EQ(series.dimension(degree), standard) << "degree " << degree;
+    }
+}
+
+TEST_F(HilbertSeriesTests, HilbertDrivenMatchesBuchberger) {
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        X * X + Y * Y + Z * Z + W * W, X * Y + Y * Z + Z * W, X * Y * Z - (W ^ 3)};
+
+    const HilbertSeries hilbert = HilbertSeries::ofLeadingMonomials(
+        calculateGroebnerBasis(F, GradedRevLexOrder(variables)), GradedRevLexOrder(variables));
+
+    GroebnerStats stats;
+    GroebnerOptions options;
+    options.stats = &stats;
+    const auto G = extendToGroebnerBasisHilbertDriven(F, LexOrder(variables), hilbert, options);
+
+    EXPECT_EQ(HilbertSeries::ofLeadingMonomials(G, LexOrder(variables)), hilbert);
+    expectSameBasis(reduceGroebnerBasis(G, LexOrder(variables), true),
+                    calculateGroebnerBasis(F, LexOrder(variables)));
+    EXPECT_GT(stats.hilbertSkipped, 0);
+}
+
+TEST_F(HilbertSeriesTests, ConvertGroebnerBasis) {
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        (X ^ 2) - Y * W, (Y ^ 2) - X * Z, X * Y - Z * W, (Z ^ 3) - (W ^ 3)};
+
+    const auto G = calculateGroebnerBasis(F, GradedRevLexOrder(variables));
+    expectSameBasis(convertGroebnerBasis(G, GradedRevLexOrder(variables), LexOrder(variables)),
+                    calculateGroebnerBasis(F, LexOrder(variables)));
+}
+
+TEST_F(HilbertSeriesTests, Homogenized) {
+    //  Affine system, homogenized with `W` and dehomogenized again after the conversion
+    const std::vector<MultivariatePolynomial<BigRational>> affine = {
+        (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1, X * Y - Z, X + Y + Z};
+    std::vector<MultivariatePolynomial<BigRational>> homogeneous;
+    for (const MultivariatePolynomial<BigRational>& f : affine) {
+        homogeneous.push_back(f.homogenize('W'));
+    }
+
+    const std::vector<char> xyz = {'X', 'Y', 'Z'};
+    const std::vector<char> xyzw = {'X', 'Y', 'Z', 'W'};
+    const auto G = calculateGroebnerBasis(homogeneous, GradedRevLexOrder(xyzw));
+    const auto H = convertGroebnerBasis(G, GradedRevLexOrder(xyzw), LexOrder(xyzw));
+
+    std::vector<MultivariatePolynomial<BigRational>> dehomogenized;
+    for (const MultivariatePolynomial<BigRational>& h : H) {
+        dehomogenized.push_back(h.dehomogenize('W'));
+    }
+    expectSameBasis(calculateGroebnerBasis(dehomogenized, LexOrder(xyz)),
+                    calculateGroebnerBasis(affine, LexOrder(xyz)));
+}
+
+TEST_F(HilbertSeriesTests, RejectsInhomogeneousInput) {
+    const std::vector<MultivariatePolynomial<BigRational>> F = {X * X - Y};
+    const HilbertSeries hilbert({Monomial("X^2")}, 2);
+    EXPECT_THROW(extendToGroebnerBasisHilbertDriven(F, LexOrder({'X', 'Y'}), hilbert),
+                 std::invalid_argument);
+
+    //  Series of another ideal
+    const std::vector<MultivariatePolynomial<BigRational>> G = {X * X - Y * Y};
+    EXPECT_THROW(extendToGroebnerBasisHilbertDriven(G, LexOrder({'X', 'Y'}),
+                                                    HilbertSeries({Monomial("X")}, 2)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,45 @@
+#include "Logger.hpp"
+
+#include <gtest/gtest.h>
+
+class LoggerTests : public ::testing::Test {
+protected:
+    void TearDown() override { Logger::setLevel(Logger::Level::Debug); }
+
+    std::string countedMessage() {
+        evaluations++;
+        return "message";
+    }
+
+    int evaluations = 0;
+};
+
+TEST_F(LoggerTests, MessagesAreLazy) {
+    Logger::setLevel(Logger::Level::Off);
+    LOG_SOLVER(countedMessage());
+    LOG_GROEBNER(countedMessage());
+    LOG_CHARACTERISTIC_DEBUG(countedMessage());
+    EXPECT_EQ(evaluations, 0);
+
+    Logger::setLevel(Logger::Level::Info);
+    LOG_SOLVER_DEBUG(countedMessage());
+    EXPECT_EQ(evaluations, 0);
+
+    testing::internal::CaptureStdout();
+    LOG_SOLVER(countedMessage());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(evaluations, Logger::enabled_solver ? 1 : 0);
+    EXPECT_EQ(output, Logger::enabled_solver ? "message\n" : "");
+}
+
+TEST_F(LoggerTests, MessagesWithCommas) {
+    Logger::setLevel(Logger::Level::Debug);
+
+    testing::internal::CaptureStdout();
+    LOG_SOLVER_DEBUG([&] {
+        std::pair<int, int> pair = {1, 2};
+        return std::to_string(pair.first) + ", " + std::to_string(pair.second);
+    }());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, Logger::enabled_solver ? "1, 2\n" : "");
+}
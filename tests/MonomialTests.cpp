@@ -1,4 +1,5 @@
 #include "Monomial.hpp"
+#include "MonomialOrders.hpp"
 
 #include <gtest/gtest.h>
 
@@ -245,3 +246,168 @@ TEST_F(MonomialTests, LeastCommonMultipleNoOverlappingVariables) {
     });
     EXPECT_EQ(result, expected);
 }
+
+TEST_F(MonomialTests, MonomialOrders) {
+    const std::vector<char> permutation = {'y', 'x', 'z'};
+
+    //  Comparisons by exponent lookup along the permutation, 'w' is not part of it
+    auto lex = [&](const Monomial& a, const Monomial& b) {
+        for (char var : permutation) {
+            if (a.getExponent(var) != b.getExponent(var)) {
+                return a.getExponent(var) < b.getExponent(var) ? -1 : 1;
+            }
+        }
+        return 0;
+    };
+    auto weight = [](const Monomial& a) {
+        return 2 * a.getExponent('y') + a.getExponent('x') + 4 * a.getExponent('z');
+    };
+
+    std::vector<Monomial> monomials;
+    for (int x = 0; x < 3; x++) {
+        for (int y = 0; y < 3; y++) {
+            for (int z = 0; z < 3; z++) {
+                for (int w = 0; w < 2; w++) {
+                    monomials.push_back(Monomial({
+                        {'x', x},
+                        {'y', y},
+                        {'z', z},
+                        {'w', w}
+                    }));
+                }
+            }
+        }
+    }
+
+    const LexOrder lexOrder(permutation);
+    const GradedLexOrder gradedLexOrder(permutation);
+    const GradedRevLexOrder gradedRevLexOrder(permutation);
+    const WeightedOrder weightedOrder({2, 1, 4}, permutation);
+    const MonomialOrder& virtualOrder = gradedRevLexOrder;
+
+    for (const Monomial& a : monomials) {
+        for (const Monomial& b : monomials) {
+            EXPECT_EQ(lexOrder.compare(a, b), lex(a, b) < 0);
+
+            const bool gradedLess = a.getDegree() != b.getDegree() ?
+                                        a.getDegree() < b.getDegree() :
+                                        lex(a, b) < 0;
+            EXPECT_EQ(gradedLexOrder.compare(a, b), gradedLess);
+
+            const bool gradedRevLess = a.getDegree() != b.getDegree() ?
+                                           a.getDegree() < b.getDegree() :
+                                           lex(a, b) > 0;
+            EXPECT_EQ(gradedRevLexOrder.compare(a, b), gradedRevLess);
+            EXPECT_EQ(virtualOrder.compare(a, b), gradedRevLess);
+
+            const bool weightedLess =
+                weight(a) != weight(b) ? weight(a) < weight(b) : lex(a, b) < 0;
+            EXPECT_EQ(weightedOrder.compare(a, b), weightedLess);
+        }
+    }
+}
+
+TEST_F(MonomialTests, MonomialOrderKeys) {
+    const GradedRevLexOrder order({'x', 'y', 'z'});
+    const LexOrder lexOrder({'x', 'y', 'z'});
+    const WeightedOrder weightedOrder({2, 1, 1}, {'x', 'y', 'z'});
+
+    //  With twelve variables the exponents get 8 bits after the degree, larger ones fall back to
+    //  the exponent walk
+    const std::vector<char> variables = {
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'x', 'y', 'z', 'w'};
+    const GradedLexOrder wideOrder(variables);
+    const LexOrder wideLexOrder(variables);
+    Monomial small("xy^2");
+    Monomial huge("xy^5000");
+    Monomial hugeLast("x^2w^5000");
+    EXPECT_TRUE(wideOrder.compare(small, huge));
+    EXPECT_FALSE(wideOrder.compare(huge, small));
+    EXPECT_TRUE(wideOrder.compare(huge, hugeLast));
+    EXPECT_TRUE(wideLexOrder.compare(huge, hugeLast));
+    EXPECT_FALSE(wideLexOrder.compare(hugeLast, huge));
+
+    //  Changing a monomial drops its cached key
+    Monomial a("x");
+    Monomial b("y^2");
+    EXPECT_TRUE(order.compare(a, b));
+    EXPECT_TRUE(weightedOrder.compare(b, a));
+    a *= Monomial("z^2");
+    EXPECT_FALSE(order.compare(a, b));
+    EXPECT_FALSE(weightedOrder.compare(a, b));
+    a /= Monomial("x");
+    EXPECT_TRUE(lexOrder.compare(a, b));
+
+    //  Copies of an order share the cached keys
+    const LexOrder copy = lexOrder;
+    EXPECT_EQ(copy.id(), lexOrder.id());
+    EXPECT_NE(order.id(), lexOrder.id());
+    EXPECT_TRUE(copy.compare(a, b));
+}
+
+TEST_F(MonomialTests, MatrixAndBlockOrders) {
+    const std::vector<char> permutation = {'y', 'x', 'z'};
+    auto blockDegree = [](const Monomial& a) {
+        return a.getExponent('y') + a.getExponent('x');
+    };
+
+    std::vector<Monomial> monomials = {Monomial("y^67108864"), Monomial("x^67108864z")};
+    for (int x = 0; x < 3; x++) {
+        for (int y = 0; y < 3; y++) {
+            for (int z = 0; z < 3; z++) {
+                monomials.push_back(Monomial({
+                    {'x', x},
+                    {'y', y},
+                    {'z', z}
+                }));
+            }
+        }
+    }
+
+    //  Graded lex packs keys, the grevlex matrix with negative entries does not
+    const MatrixOrder gradedLexMatrix({{1, 1, 1}}, permutation);
+    const MatrixOrder gradedRevLexMatrix({{1, 1, 1}, {-1, 0, 0}, {0, -1, 0}}, permutation);
+    const GradedLexOrder gradedLexOrder(permutation);
+    const GradedRevLexOrder gradedRevLexOrder(permutation);
+    const BlockOrder blockOrder({{'y', 'x'}, {'z'}});
+
+    for (const Monomial& a : monomials) {
+        for (const Monomial& b : monomials) {
+            EXPECT_EQ(gradedLexMatrix.compare(a, b), gradedLexOrder.compare(a, b));
+            EXPECT_EQ(gradedRevLexMatrix.compare(a, b), gradedRevLexOrder.compare(a, b));
+
+            //  Equal degrees in `y, x` with equal `y` also have equal `x`
+            bool blockLess = a.getExponent('z') < b.getExponent('z');
+            if (blockDegree(a) != blockDegree(b)) {
+                blockLess = blockDegree(a) < blockDegree(b);
+            }
+            else if (a.getExponent('y') != b.getExponent('y')) {
+                blockLess = a.getExponent('y') > b.getExponent('y');
+            }
+            EXPECT_EQ(blockOrder.compare(a, b), blockLess);
+        }
+    }
+
+    EXPECT_THROW(MatrixOrder({{1, 1}}, permutation), std::invalid_argument);
+    EXPECT_THROW(MatrixOrder({{0, 1, 1}, {-1, 0, 0}}, permutation), std::invalid_argument);
+    EXPECT_THROW(BlockOrder({{'x'}, {}}), std::invalid_argument);
+    EXPECT_THROW(BlockOrder({{'x', 'y'}, {'y'}}), std::invalid_argument);
+}
+
+TEST_F(MonomialTests, WeightedOrderIsExact) {
+    //  `2^53 + 1` has no double representation, rounding it would tie `x` and `y`
+    const int64_t large = int64_t(1) << 53;
+    const WeightedOrder order({large, large + 1, 1}, {'x', 'y', 'z'});
+    EXPECT_TRUE(order.compare(Monomial("x"), Monomial("y")));
+    EXPECT_FALSE(order.compare(Monomial("y"), Monomial("x")));
+
+    //  Weighted degrees beyond 64 bits and exponents beyond the packed width stay exact
+    EXPECT_TRUE(order.compare(Monomial("x^4096"), Monomial("y^4096")));
+    EXPECT_TRUE(order.compare(Monomial("z^8388608"), Monomial("x")));
+    EXPECT_TRUE(order.compare(Monomial("x^8388608"), Monomial("y^8388608")));
+    EXPECT_FALSE(order.compare(Monomial("x^8388608"), Monomial("x^8388608")));
+    EXPECT_TRUE(order.weightedDegree(Monomial("y^2z")) == 2 * large + 3);
+
+    EXPECT_THROW(WeightedOrder({1, -1}, {'x', 'y'}), std::invalid_argument);
+    EXPECT_THROW(WeightedOrder({1}, {'x', 'y'}), std::invalid_argument);
+}
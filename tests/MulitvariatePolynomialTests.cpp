@@ -153,3 +153,38 @@ TEST_F(MultivariatePolynomialTests, Substitute) {
     EXPECT_EQ(substitutePoly.substitute('x', Rational(3)), expected);
 }
 
+
+TEST_F(MultivariatePolynomialTests, Homogenize) {
+    const MultivariatePolynomial<Rational> h = defineVariable<Rational>('h');
+
+    EXPECT_FALSE(p2.isHomogeneous());
+    EXPECT_TRUE(p1.isHomogeneous());
+    EXPECT_TRUE(zeroMultivariatePolynomial.isHomogeneous());
+
+    const MultivariatePolynomial<Rational> homogenized = p3.homogenize('h');
+    EXPECT_EQ(homogenized, (x ^ 3) + x * y * y + 5 * (h ^ 3));
+    EXPECT_TRUE(homogenized.isHomogeneous());
+    EXPECT_EQ(homogenized.dehomogenize('h'), p3);
+
+    EXPECT_THROW(p3.homogenize('x'), std::invalid_argument);
+}
+
+TEST_F(MultivariatePolynomialTests, AddMulTerm) {
+    const Monomial xy("xy");
+
+    MultivariatePolynomial<Rational> p = p2;
+    p.addMulTerm(Rational(-2), xy, p4);
+    EXPECT_EQ(p, p2 - 2 * x * y * p4);
+
+    //  Terms cancelling to zero leave the polynomial
+    p.addMulTerm(Rational(2), xy, p4);
+    EXPECT_EQ(p, p2);
+    EXPECT_EQ(p.termCount(), p2.termCount());
+
+    p.addMulTerm(Rational(-1), Monomial(), p);
+    EXPECT_TRUE(p.isZeroPolynomial());
+
+    p.addTerm(Rational(3), xy).addTerm(Rational(-3), xy);
+    EXPECT_TRUE(p.isZeroPolynomial());
+    EXPECT_EQ(p.termCount(), 0);
+}
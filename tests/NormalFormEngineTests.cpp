@@ -0,0 +1,84 @@
+#include "BigRational.hpp"
+#include "GroebnerBasis.hpp"
+#include "MonomialOrders.hpp"
+#include "MultivariatePolynomial.hpp"
+#include "NormalFormEngine.hpp"
+#include "Rational.hpp"
+#include "ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+class NormalFormEngineTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        x = defineVariable<Rational>('x');
+        y = defineVariable<Rational>('y');
+        z = defineVariable<Rational>('z');
+
+        X = defineVariable<BigRational>('X');
+        Y = defineVariable<BigRational>('Y');
+        Z = defineVariable<BigRational>('Z');
+    }
+
+    MultivariatePolynomial<Rational> x;
+    MultivariatePolynomial<Rational> y;
+    MultivariatePolynomial<Rational> z;
+
+    MultivariatePolynomial<BigRational> X;
+    MultivariatePolynomial<BigRational> Y;
+    MultivariatePolynomial<BigRational> Z;
+};
+
+TEST_F(NormalFormEngineTests, MatchesPolynomialReduce) {
+    //  Not a Groebner basis, so the remainder depends on picking the first divisor like before
+    const LexOrder order({'x', 'y', 'z'});
+    const std::vector<MultivariatePolynomial<Rational>> G = {x * y - 1, (y ^ 2) - z, x + z};
+    const std::vector<MultivariatePolynomial<Rational>> fs = {
+        (x ^ 2) * y + x * (y ^ 2) + (y ^ 2), (x ^ 3) * (z ^ 2) - y, x * y * z + 7, Rational(3)};
+
+    for (const MultivariatePolynomial<Rational>& f : fs) {
+        ReductionCounters counters;
+        ReductionCounters expectedCounters;
+        EXPECT_EQ(normalForm(f, G, order, &counters),
+                  polynomialReduce(f, G, order, &expectedCounters).second);
+        EXPECT_EQ(counters.steps, expectedCounters.steps);
+    }
+}
+
+TEST_F(NormalFormEngineTests, IdealMembership) {
+    const GradedRevLexOrder order({'X', 'Y', 'Z'});
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        (X ^ 2) + (Y ^ 2) + (Z ^ 2) - 1, X * Y - Z, X - (Y ^ 2)};
+    const NormalFormEngine engine(calculateGroebnerBasis(F, order), order);
+
+    EXPECT_TRUE(engine.contains(F[0] * (X + 3) - F[1] * (Z ^ 2) + F[2] * X * Y));
+    EXPECT_TRUE(engine.contains(MultivariatePolynomial<BigRational>()));
+    EXPECT_FALSE(engine.contains(X + 1));
+
+    //  The normal form is the unique representative modulo the ideal
+    const MultivariatePolynomial<BigRational> f = (X ^ 3) * Y + Z;
+    EXPECT_EQ(engine.normalForm(f + F[1] * (Z ^ 4)), engine.normalForm(f));
+    EXPECT_TRUE(engine.contains(f - engine.normalForm(f)));
+}
+
+TEST_F(NormalFormEngineTests, BatchNormalForms) {
+    const GradedRevLexOrder order({'X', 'Y', 'Z'});
+    const std::vector<MultivariatePolynomial<BigRational>> F = {
+        (X ^ 3) - Y * Z, (Y ^ 2) - X * Z + 1, (Z ^ 2) - X};
+    const NormalFormEngine engine(calculateGroebnerBasis(F, order), order);
+
+    std::vector<MultivariatePolynomial<BigRational>> fs;
+    for (int k = 0; k < 20; k++) {
+        fs.push_back((X ^ (k % 5)) * (Y ^ (k % 3)) * (Z ^ (k % 4)) + BigRational(k));
+    }
+
+    ThreadPool pool(4);
+    const auto sequential = engine.normalForms(fs);
+    const auto parallel = engine.normalForms(fs, &pool);
+    ASSERT_EQ(sequential.size(), fs.size());
+    for (int k = 0; k < fs.size(); k++) {
+        EXPECT_EQ(sequential[k], engine.normalForm(fs[k]));
+        EXPECT_EQ(parallel[k], sequential[k]);
+    }
+}
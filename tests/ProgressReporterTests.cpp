@@ -0,0 +1,67 @@
+#include "GroebnerBasis.hpp"
+#include "ProgressReporter.hpp"
+#include "Rational.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+TEST(ProgressReporterTests, Throttling) {
+    using Report = std::pair<int64_t, int64_t>;
+    std::vector<Report> reports;
+    auto record = [&](int64_t current, int64_t total) { reports.push_back({current, total}); };
+
+    ProgressReporter eager(record, std::chrono::nanoseconds(0));
+    eager.start(3);
+    eager.advance();
+    eager.advance(2);
+    eager.finish();
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[0], Report(1, 3));
+    EXPECT_EQ(reports[1], Report(3, 3));
+    EXPECT_EQ(reports[2], Report(3, 3));
+
+    reports.clear();
+    ProgressReporter lazy(record, std::chrono::hours(1));
+    lazy.start(1'000);
+    for (int i = 0; i < 1'000; i++) {
+        lazy.advance();
+    }
+    lazy.finish();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0], Report(1'000, 1'000));
+}
+
+TEST(ProgressReporterTests, GroebnerBasisProgress) {
+    auto x = defineVariable<Rational>('x');
+    auto y = defineVariable<Rational>('y');
+    auto z = defineVariable<Rational>('z');
+    std::vector<MultivariatePolynomial<Rational>> F = {x * x + y * y + z * z - 1, x * y - z,
+                                                       y * z - x};
+
+    //  The callback runs concurrently on the pool threads
+    std::atomic<int64_t> lastCurrent(0);
+    std::atomic<int64_t> lastTotal(-1);
+    std::atomic<int> finished(0);
+    std::atomic<int> overshoots(0);
+    ProgressReporter progress(
+        [&](int64_t current, int64_t total) {
+            overshoots += current > total;
+            finished += current == total;
+            lastCurrent = current;
+            lastTotal = total;
+        },
+        std::chrono::nanoseconds(0));
+
+    GroebnerOptions options;
+    options.numThreads = 4;
+    options.progress = &progress;
+    GroebnerResult<Rational> result =
+        tryExtendToGroebnerBasis(F, LexOrder({'x', 'y', 'z'}), options);
+
+    ASSERT_TRUE(result.completed());
+    EXPECT_EQ(overshoots, 0);
+    EXPECT_GE(finished, result.stats.iterations);
+    EXPECT_EQ(lastCurrent, lastTotal);
+}
@@ -234,4 +234,11 @@ TEST_F(RationalTests, ChainedOperations) {
     d += Rational(1, 6);
     d *= Rational(6, 5);
     EXPECT_EQ(d, Rational(1, 1));
-}
\ No newline at end of file
+}
+
+TEST_F(RationalTests, BitLength) {
+    EXPECT_EQ(Rational(0).bitLength(), 1);
+    EXPECT_EQ(Rational(1).bitLength(), 2);
+    EXPECT_EQ(Rational(-7, 8).bitLength(), 7);
+    EXPECT_EQ(Rational(INT64_MIN).bitLength(), 65);
+}
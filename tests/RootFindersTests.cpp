@@ -169,3 +169,107 @@ TEST_F(RootFindersTests, FindRealRoots) {
     EXPECT_TRUE(std::find(roots.begin(), roots.end(), Real(2)) != roots.end());
     EXPECT_TRUE(std::find(roots.begin(), roots.end(), Real(0)) != roots.end());
 }
+
+TEST_F(RootFindersTests, FindRationalRootsRepeated) {
+    auto f = ((x - 2) ^ 3) * ((3 * x + 1) ^ 2) * (x * x + 1);
+    std::vector<Rational> roots = findRationalRoots(fromMultivariateToUnivariate(f));
+
+    ASSERT_EQ(roots.size(), 2);
+    EXPECT_EQ(roots[0], Rational(-1, 3));
+    EXPECT_EQ(roots[1], Rational(2));
+}
+
+TEST_F(RootFindersTests, FindBigRationalRootsLargeCoefficients) {
+    BigRational r1("1000000000000000000000007/999999999989");
+    BigRational r2("-340282366920938463463374607431768211297");
+    auto f = (X - r1) * (X - r2) * ((X ^ 2) - 2) * X;
+
+    std::vector<BigRational> roots = findBigRationalRoots(fromMultivariateToUnivariate(f));
+
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_EQ(roots[0], r2);
+    EXPECT_EQ(roots[1], BigRational(0));
+    EXPECT_EQ(roots[2], r1);
+}
+
+TEST_F(RootFindersTests, FindRealRootsLargeBoundCloseRoots) {
+    auto f = (t - 1'000'000) * (t - 1) * (t - 1.001) * (2 * t + 1) * (t * t + 1);
+    std::vector<Real> roots = findRealRoots(fromMultivariateToUnivariate(f));
+
+    ASSERT_EQ(roots.size(), 4);
+    EXPECT_EQ(roots[0], Real(-0.5));
+    EXPECT_EQ(roots[1], Real(1));
+    EXPECT_EQ(roots[2], Real(1.001));
+    EXPECT_EQ(roots[3], Real(1'000'000));
+}
+
+TEST_F(RootFindersTests, FindComplexRoots) {
+    auto w = defineVariable<Complex>('w');
+
+    std::vector<Complex> roots = findComplexRoots(fromMultivariateToUnivariate((w ^ 4) - 1));
+    ASSERT_EQ(roots.size(), 4);
+    EXPECT_EQ(roots[0], Complex(-1));
+    EXPECT_EQ(roots[1], Complex(0, -1));
+    EXPECT_EQ(roots[2], Complex(0, 1));
+    EXPECT_EQ(roots[3], Complex(1));
+
+    roots = findComplexRoots(fromMultivariateToUnivariate((w - Complex(2, 3)) * (w + 5)));
+    ASSERT_EQ(roots.size(), 2);
+    EXPECT_EQ(roots[0], Complex(-5));
+    EXPECT_EQ(roots[1], Complex(2, 3));
+}
+
+TEST_F(RootFindersTests, FindRealRootsAberth) {
+    std::vector<Real> roots =
+        findRealRootsAberth(fromMultivariateToUnivariate((t ^ 3) + 4 * (t ^ 2) - 11 * t - 2));
+
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_EQ(roots[0], Real(-5.82842712474619));
+    EXPECT_EQ(roots[1], Real(-0.171572875253810));
+    EXPECT_EQ(roots[2], Real(2));
+
+    roots = findRealRootsAberth(fromMultivariateToUnivariate((t ^ 4) + 1));
+    EXPECT_TRUE(roots.empty());
+}
+
+TEST_F(RootFindersTests, FindRootsWithMultiplicities) {
+    auto f = fromMultivariateToUnivariate(((x - 1) ^ 3) * ((x + 4) ^ 2) * (x - 7));
+    auto roots = findRootsWithMultiplicities<Rational>(f, findRationalRoots);
+
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_EQ(roots[0], std::make_pair(Rational(-4), 2));
+    EXPECT_EQ(roots[1], std::make_pair(Rational(1), 3));
+    EXPECT_EQ(roots[2], std::make_pair(Rational(7), 1));
+
+    GaloisField::setPrime(5);
+    auto g = fromMultivariateToUnivariate(((a - 2) ^ 5) * (a + 1));
+    auto gfRoots = findRootsWithMultiplicities<GaloisField>(g, findGaloisFieldRoots);
+
+    ASSERT_EQ(gfRoots.size(), 2);
+    EXPECT_EQ(gfRoots[0], std::make_pair(GaloisField(2), 5));
+    EXPECT_EQ(gfRoots[1], std::make_pair(GaloisField(4), 1));
+    GaloisField::setPrime(7);
+
+    auto h = fromMultivariateToUnivariate(((t - 2) ^ 2) * (t + 3));
+    auto realRoots = findRootsWithMultiplicities<Real>(h, findRealRoots);
+
+    ASSERT_EQ(realRoots.size(), 2);
+    EXPECT_EQ(realRoots[0], std::make_pair(Real(-3), 1));
+    EXPECT_EQ(realRoots[1], std::make_pair(Real(2), 2));
+}
+
+TEST_F(RootFindersTests, SquareFreeRootFinders) {
+    EXPECT_EQ(findRationalRootsSquareFree(fromMultivariateToUnivariate((x - 1) * (x + 4))),
+              std::vector<Rational>({Rational(-4), Rational(1)}));
+
+    //  The factors passed to the root finder are square-free already
+    auto f = fromMultivariateToUnivariate(((x - 1) ^ 3) * ((x + 4) ^ 2) * (x - 7));
+    EXPECT_EQ(findRootsWithMultiplicities<Rational>(f, findRationalRootsSquareFree),
+              findRootsWithMultiplicities<Rational>(f, findRationalRoots));
+
+    GaloisField::setPrime(5);
+    auto g = fromMultivariateToUnivariate(((a - 2) ^ 5) * (a + 1));
+    EXPECT_EQ(findRootsWithMultiplicities<GaloisField>(g, findGaloisFieldRootsSquareFree),
+              findRootsWithMultiplicities<GaloisField>(g, findGaloisFieldRoots));
+    GaloisField::setPrime(7);
+}
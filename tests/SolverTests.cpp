@@ -85,6 +85,65 @@ TEST_F(SolverTests, CharacteristicEquationsInconsistentSystem) {
     EXPECT_TRUE(charEqs2.empty());
 }
 
+TEST_F(SolverTests, ParallelCharacteristicEquations) {
+    auto f1 = x * x + y * y + z * z - 3;
+    auto f2 = x - y;
+    auto f3 = y * z - 1;
+    std::vector<MultivariatePolynomial<Rational>> system = {f1, f2, f3};
+
+    auto serial = characteristicEquations(system);
+    auto parallel = characteristicEquations(system, 4);
+    ASSERT_EQ(parallel.size(), 3);
+    EXPECT_EQ(parallel, serial);
+
+    //  Failure for one variable cancels the others
+    EXPECT_TRUE(characteristicEquations<Rational>({x + y - 1, x + y - 11}, 4).empty());
+    EXPECT_TRUE(characteristicEquations<Rational>({x * y - 1, x * z - 1}, 4).empty());
+}
+
+TEST_F(SolverTests, ParallelBranches) {
+    auto f1 = (x - 1) * (x - 2) * (x - 3);
+    auto f2 = (y - x) * (y + 1);
+    auto f3 = z * z - y * y;
+
+    SolverOptions options;
+    options.numThreads = 4;
+    auto serial = solveSystem<Rational>({f1, f2, f3}, findRationalRoots);
+    auto parallel = solveSystem<Rational>({f1, f2, f3}, findRationalRoots, options);
+
+    using Solutions = std::vector<std::map<char, Rational>>;
+    ASSERT_TRUE(std::holds_alternative<Solutions>(parallel));
+    EXPECT_EQ(std::get<Solutions>(parallel).size(), 12);
+    EXPECT_EQ(std::get<Solutions>(parallel), std::get<Solutions>(serial));
+
+    auto infinite =
+        solveSystem<Rational>({(x - 1) * (x - 2) * (y - z)}, findRationalRoots, options);
+    ASSERT_TRUE(std::holds_alternative<std::string>(infinite));
+    EXPECT_EQ(std::get<std::string>(infinite), "There are infinitely many solutions");
+}
+
+TEST_F(SolverTests, ComputationBudget) {
+    auto f1 = (x - 1) * (x - 2) * (x - 3);
+    auto f2 = (y - x) * (y + 1);
+
+    SolverOptions options;
+    options.budget.cancellation.cancel();
+    auto cancelled = solveSystem<Rational>({f1, f2}, findRationalRoots, options);
+    ASSERT_TRUE(std::holds_alternative<std::string>(cancelled));
+    EXPECT_EQ(std::get<std::string>(cancelled), "Computation aborted: cancelled");
+
+    options = {};
+    options.budget.maxPairs = 0;
+    auto limited = solveSystem<Rational>({f1, f2}, findRationalRoots, options);
+    ASSERT_TRUE(std::holds_alternative<std::string>(limited));
+    EXPECT_EQ(std::get<std::string>(limited), "Computation aborted: S-pair limit exceeded");
+
+    ComputationBudget budget;
+    budget.maxPairs = 0;
+    EXPECT_THROW(characteristicEquations<Rational>({f1, f2}, 2, budget), OperationCancelled);
+    EXPECT_FALSE(budget.cancellation.isCancelled());
+}
+
 TEST_F(SolverTests, CharacteristicEquationsSingleVariable) {
     std::vector<MultivariatePolynomial<Rational>> singleVarSystem;
     singleVarSystem.push_back(3 * (x ^ 99) + 1);
@@ -154,6 +213,25 @@ TEST_F(SolverTests, OneMoreEqButSolvable) {
     EXPECT_EQ(solution.size(), 2);
 }
 
+TEST_F(SolverTests, IncrementalSolve) {
+    using Solutions = std::vector<std::map<char, Rational>>;
+    GroebnerBasis<Rational> basis({x + y - 3}, LexOrder({'x', 'y'}));
+
+    EXPECT_TRUE(basis.addGenerator(x * y - 2));
+    auto _ = solveSystem<Rational>(basis, findRationalRoots);
+    EXPECT_EQ(std::get<Solutions>(_).size(), 2);
+
+    EXPECT_TRUE(basis.addGenerator(x - 1));
+    _ = solveSystem<Rational>(basis, findRationalRoots);
+    Solutions solution = std::get<Solutions>(_);
+    ASSERT_EQ(solution.size(), 1);
+    EXPECT_EQ(solution[0]['y'], Rational(2));
+
+    EXPECT_TRUE(basis.addGenerator(y - 1));
+    _ = solveSystem<Rational>(basis, findRationalRoots);
+    EXPECT_EQ(std::get<std::string>(_), "No solution exist in any field extension");
+}
+
 TEST_F(SolverTests, Mod2) {
     GaloisField::setPrime(2);
     auto f1 = a + b - 1;
@@ -289,3 +367,17 @@ TEST_F(SolverTests, TwoAndFive) {
     EXPECT_TRUE(std::find(solution.begin(), solution.end(), sol1) != solution.end());
     EXPECT_TRUE(std::find(solution.begin(), solution.end(), sol2) != solution.end());
 }
+
+TEST_F(SolverTests, ComplexSolutions) {
+    auto p = defineVariable<Complex>('p');
+    auto q = defineVariable<Complex>('q');
+
+    auto _ = solveSystem<Complex>({(p ^ 2) + 1, q - 2 * p}, findComplexRoots);
+    auto solution = std::get<std::vector<std::map<char, Complex>>>(_);
+
+    ASSERT_EQ(solution.size(), 2);
+    for (const std::map<char, Complex>& sol : solution) {
+        EXPECT_EQ(sol.at('p') * sol.at('p'), Complex(-1));
+        EXPECT_EQ(sol.at('q'), Complex(2) * sol.at('p'));
+    }
+}
@@ -0,0 +1,55 @@
+#include "ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+
+TEST(ThreadPoolTests, ParallelFor) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), ThreadPool::threadsSupported ? 4 : 1);
+
+    std::vector<int> squares(1'000);
+    pool.parallelFor(squares.size(), [&](int i) { squares[i] = i * i; });
+    for (int i = 0; i < squares.size(); i++) {
+        EXPECT_EQ(squares[i], i * i);
+    }
+}
+
+TEST(ThreadPoolTests, NestedParallelFor) {
+    ThreadPool pool(3);
+    std::vector<std::vector<int>> rows(16, std::vector<int>(64));
+
+    //  Waiting threads help with queued tasks, so nesting cannot deadlock
+    pool.parallelFor(rows.size(), [&](int i) {
+        pool.parallelFor(rows[i].size(), [&](int j) { rows[i][j] = i + j; });
+    });
+
+    for (int i = 0; i < rows.size(); i++) {
+        EXPECT_EQ(std::accumulate(rows[i].begin(), rows[i].end(), 0), 64 * i + 63 * 32);
+    }
+}
+
+TEST(ThreadPoolTests, ExceptionPropagation) {
+    ThreadPool pool(4);
+    std::atomic<int> finished(0);
+
+    EXPECT_THROW(pool.parallelFor(100,
+                                  [&](int i) {
+                                      if (i == 42) {
+                                          throw std::runtime_error("failed");
+                                      }
+                                      finished++;
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(finished, 99);
+}
+
+TEST(ThreadPoolTests, SingleThread) {
+    ThreadPool pool(1);
+    EXPECT_EQ(pool.size(), 1);
+
+    int sum = 0;
+    pool.parallelFor(10, [&](int i) { sum += i; });
+    EXPECT_EQ(sum, 45);
+}
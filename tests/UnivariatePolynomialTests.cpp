@@ -1,3 +1,5 @@
+#include "BigRational.hpp"
+#include "GaloisField.hpp"
 #include "Rational.hpp"
 #include "UnivariatePolynomial.hpp"
 
@@ -289,4 +291,88 @@ TEST_F(UnivariatePolynomialTests, Derivative) {
     std::vector<Rational> coeffsq = {Rational(7), Rational(0), Rational(-3), Rational(8)};
     auto q = UnivariatePolynomial<Rational>(coeffsq);
     EXPECT_EQ(q, p5.derivative());
-}
\ No newline at end of file
+}
+
+TEST_F(UnivariatePolynomialTests, EvaluateMany) {
+    std::vector<Rational> points;
+    for (int i = -50; i <= 50; i++) {
+        points.push_back(Rational(i, 7));
+    }
+
+    std::vector<Rational> values = p5.evaluateMany(points);
+    ASSERT_EQ(values.size(), points.size());
+    for (int i = 0; i < points.size(); i++) {
+        EXPECT_EQ(values[i], p5.evaluate(points[i]));
+    }
+
+    std::vector<BigRational> coeffs;
+    for (int i = 0; i < 40; i++) {
+        coeffs.push_back(BigRational((i * 7) % 11 - 5, 1 + i % 3));
+    }
+    UnivariatePolynomial<BigRational> f(coeffs);
+
+    std::vector<BigRational> fractions;
+    for (int i = -3; i <= 3; i++) {
+        for (int j = 1; j <= 12; j++) {
+            fractions.push_back(BigRational(i, j));
+        }
+    }
+
+    std::vector<BigRational> bigValues = f.evaluateMany(fractions);
+    ASSERT_EQ(bigValues.size(), fractions.size());
+    for (int i = 0; i < fractions.size(); i++) {
+        EXPECT_EQ(bigValues[i], f.evaluate(fractions[i]));
+    }
+
+    EXPECT_TRUE(f.evaluateMany({}).empty());
+
+    //  A block of `findGaloisFieldRoots` candidates
+    GaloisField::setPrime(32003);
+    const int degree = 129;
+    std::vector<GaloisField> fieldCoeffs;
+    for (int i = 0; i <= degree; i++) {
+        fieldCoeffs.push_back(GaloisField((i * 7919) % 32003));
+    }
+    UnivariatePolynomial<GaloisField> g(fieldCoeffs);
+
+    std::vector<GaloisField> candidates;
+    for (int i = 0; i < 4096; i++) {
+        candidates.push_back(GaloisField(i));
+    }
+    std::vector<GaloisField> fieldValues = g.evaluateMany(candidates);
+    ASSERT_EQ(fieldValues.size(), candidates.size());
+    for (int i = 0; i < candidates.size(); i++) {
+        EXPECT_EQ(fieldValues[i], g.evaluate(candidates[i]));
+    }
+}
+
+TEST_F(UnivariatePolynomialTests, SquareFreeDecomposition) {
+    UnivariatePolynomial<Rational> a = makePolynomial<Rational>({-1, 1});
+    UnivariatePolynomial<Rational> b = makePolynomial<Rational>({2, 1});
+    UnivariatePolynomial<Rational> c = makePolynomial<Rational>({1, 0, 1});
+
+    auto decomposition = squareFreeDecomposition(a.power(3) * b.power(2) * c * Rational(5));
+    ASSERT_EQ(decomposition.size(), 3);
+    EXPECT_EQ(decomposition[0], std::make_pair(c, 1));
+    EXPECT_EQ(decomposition[1], std::make_pair(b, 2));
+    EXPECT_EQ(decomposition[2], std::make_pair(a, 3));
+
+    EXPECT_EQ(squareFreePart(a.power(4) * b), a * b);
+    EXPECT_TRUE(squareFreeDecomposition(UnivariatePolynomial<Rational>(Rational(3))).empty());
+}
+
+TEST_F(UnivariatePolynomialTests, SquareFreeDecompositionPrimeCharacteristic) {
+    GaloisField::setPrime(3);
+    UnivariatePolynomial<GaloisField> a = makePolynomial<GaloisField>({1, 1});
+    UnivariatePolynomial<GaloisField> b = makePolynomial<GaloisField>({2, 1});
+
+    //  `(x + 1)³` has zero derivative over `F_3`
+    auto decomposition = squareFreeDecomposition(a.power(3) * b.power(2));
+    ASSERT_EQ(decomposition.size(), 2);
+    EXPECT_EQ(decomposition[0], std::make_pair(b, 2));
+    EXPECT_EQ(decomposition[1], std::make_pair(a, 3));
+
+    decomposition = squareFreeDecomposition(a.power(6));
+    ASSERT_EQ(decomposition.size(), 1);
+    EXPECT_EQ(decomposition[0], std::make_pair(a, 6));
+}